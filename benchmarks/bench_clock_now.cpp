@@ -0,0 +1,94 @@
+/*
+ * Measures the throughput of virtual_clock::steady::now()
+ * while all hardware threads read the clock concurrently
+ * and the clock is advanced in parallel, as the main loop of cycle_control does.
+ *
+ * For comparison the same is measured for an std::atomic<time_point>,
+ * which was used as storage of the clock before.
+ */
+
+#include <benchmark.hpp>
+
+#include <flexcore/scheduler/clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using time_point = fc::virtual_clock::steady::time_point;
+std::atomic<time_point> old_storage{time_point{}};
+
+/// former implementation of now() and advance(), load and store of an atomic time_point
+time_point old_now() { return old_storage.load(); }
+void old_advance()
+{
+	const auto tmp = old_storage.load();
+	old_storage.store(tmp + std::chrono::milliseconds(1));
+}
+
+/**
+ * Calls now from all reader threads for duration and advances the clock meanwhile.
+ * \returns total number of calls to now per second
+ */
+template <class now_t, class advance_t>
+double reads_per_second(now_t now, advance_t advance, size_t nr_of_readers)
+{
+	std::atomic<bool> stop{false};
+	std::vector<size_t> reads(nr_of_readers, 0);
+	std::vector<std::thread> readers;
+	for (size_t i = 0; i != nr_of_readers; ++i)
+		readers.emplace_back([&, i]
+		{
+			size_t count = 0;
+			auto last = now();
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				const auto t = now();
+				// keep the compiler from removing the call
+				last = std::max(last, t);
+				++count;
+			}
+			reads[i] = count + (last == time_point{} ? 1 : 0);
+		});
+
+	const auto duration = std::chrono::milliseconds(500);
+	const auto start = bench::clock::now();
+	while (bench::clock::now() - start < duration)
+	{
+		advance();
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+	stop.store(true);
+	for (auto& r : readers)
+		r.join();
+
+	size_t total = 0;
+	for (auto r : reads)
+		total += r;
+	return total / std::chrono::duration<double>(duration).count();
+}
+
+} // namespace
+
+int main()
+{
+	using master = fc::master_clock<fc::virtual_clock::period>;
+	const size_t nr_of_readers = std::max(1u, std::thread::hardware_concurrency());
+	std::cout << "reader threads: " << nr_of_readers << "\n";
+
+	const auto old_reads = reads_per_second(old_now, old_advance, nr_of_readers);
+	bench::report("atomic<time_point> now()", old_reads / 1e6, "M reads/s");
+	const auto new_reads = reads_per_second(
+			[] { return fc::virtual_clock::steady::now(); },
+			[] { master::advance(std::chrono::milliseconds(1)); },
+			nr_of_readers);
+	bench::report("virtual_clock::steady::now()", new_reads / 1e6, "M reads/s");
+	std::cout << "lock-free: atomic<time_point> " << old_storage.is_lock_free()
+	          << ", virtual_clock::time_storage "
+	          << fc::virtual_clock::time_storage{}.is_lock_free() << "\n";
+	return 0;
+}
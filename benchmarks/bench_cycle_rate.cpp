@@ -0,0 +1,78 @@
+/*
+ * Measures how precisely cycle_control keeps a 1kHz cycle.
+ *
+ * A single task records the wall clock time at which it starts,
+ * jitter is the deviation of the tick start times from the ideal deadlines.
+ * All timing modes of the realtime main loop are compared.
+ */
+
+#include <benchmark.hpp>
+
+#include <flexcore/scheduler/cyclecontrol.hpp>
+#include <flexcore/scheduler/parallelscheduler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+void benchmark(const std::string& name, fc::thread::main_loop_timing timing)
+{
+	using namespace std::chrono_literals;
+	namespace sched = fc::thread;
+	const auto period = 1ms;
+	const auto run_time = 2s;
+
+	sched::cycle_control controller{std::make_unique<sched::parallel_scheduler>(), period};
+	controller.set_main_loop_timing(timing);
+	std::vector<bench::clock::time_point> starts;
+	starts.reserve(run_time / period + 100);
+	controller.add_task({[&]
+	{
+		if (starts.size() < starts.capacity())
+			starts.push_back(bench::clock::now());
+	}}, period);
+
+	controller.start();
+	std::this_thread::sleep_for(run_time);
+	controller.stop();
+
+	if (starts.size() < 2)
+		return;
+
+	// deviation of every tick start from the ideal deadline series, relative to the first tick.
+	std::vector<double> jitter_us;
+	for (size_t i = 1; i != starts.size(); ++i)
+	{
+		const auto actual = std::chrono::duration<double, std::micro>(starts[i] - starts[0]);
+		const auto ideal = std::round(actual.count() / 1000.0) * 1000.0;
+		jitter_us.push_back(std::abs(actual.count() - ideal));
+	}
+	std::sort(begin(jitter_us), end(jitter_us));
+	const auto total = std::chrono::duration<double>(starts.back() - starts.front()).count();
+
+	std::cout << name << "\n";
+	bench::report("  achieved rate", (starts.size() - 1) / total, "Hz");
+	bench::report("  overruns", controller.nr_of_overruns(), "");
+	bench::report("  median tick start jitter", jitter_us[jitter_us.size() / 2], "us");
+	bench::report("  99th percentile tick start jitter",
+	              jitter_us[jitter_us.size() * 99 / 100], "us");
+	bench::report("  max tick start jitter", jitter_us.back(), "us");
+}
+
+} // namespace
+
+int main()
+{
+	using namespace std::chrono_literals;
+	fc::thread::main_loop_timing timing;
+	benchmark("relative sleep", timing);
+	timing.absolute_deadlines = true;
+	benchmark("absolute deadlines", timing);
+	timing.spin_time = 100us;
+	benchmark("absolute deadlines, 100us spin", timing);
+	return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Measures the throughput of event_source::fire depending on the number of connected sinks
+ * for the default handler storage, a vector of std::function,
+ * and the inline handler storage, which keeps small handlers in one contiguous array.
+ *
+ * Sinks are connected alternately as lambdas through a connection and as event_sinks,
+ * the two most common ways to connect to an event_source.
+ * Both fit into the small buffer of std::function.
+ * A second run connects lambdas with a capture too large for it, but small enough for
+ * the inline buffer, as for example connections through several stateful nodes.
+ */
+
+#include <benchmark.hpp>
+
+#include <flexcore/core/connection.hpp>
+#include <flexcore/pure/event_sinks.hpp>
+#include <flexcore/pure/event_sources.hpp>
+
+#include <array>
+#include <vector>
+
+namespace
+{
+
+using fc::operator>>;
+
+const std::array<size_t, 6> nr_of_sinks{{1, 2, 5, 10, 20, 40}};
+
+template <class source_t, class connect_t>
+void benchmark(const std::string& name, size_t sinks, connect_t connect)
+{
+	source_t source;
+	std::vector<long> values(sinks);
+	// reserved, as connected sinks must not be moved.
+	std::vector<fc::pure::event_sink<int>> event_sinks;
+	event_sinks.reserve(sinks);
+	for (size_t i = 0; i != sinks; ++i)
+		connect(source, values[i], event_sinks, i);
+
+	int event = 0;
+	const auto fire_ns = bench::mean_ns(200000, [&] { source.fire(++event); });
+	bench::report(name + ", " + std::to_string(sinks) + " sinks", 1e9 / fire_ns, "events/s");
+}
+
+struct connect_mixed
+{
+	template <class source_t>
+	void operator()(source_t& source, long& value,
+			std::vector<fc::pure::event_sink<int>>& event_sinks, size_t i) const
+	{
+		if (i % 2 == 0)
+		{
+			source >> [](int v) { return v + 1; } >> [&value](int v) { value += v; };
+		}
+		else
+		{
+			event_sinks.emplace_back([&value](int v) { value += v; });
+			source >> event_sinks.back();
+		}
+	}
+};
+
+struct connect_large_capture
+{
+	template <class source_t>
+	void operator()(source_t& source, long& value,
+			std::vector<fc::pure::event_sink<int>>&, size_t) const
+	{
+		std::array<long*, 3> targets{{&value, &value, &value}};
+		source >> [targets](int v) { *targets[0] += v; *targets[1] += 1; *targets[2] -= 1; };
+	}
+};
+
+template <class connect_t>
+void benchmark_all(const std::string& name, connect_t connect)
+{
+	for (auto sinks : nr_of_sinks)
+		benchmark<fc::pure::event_source<int>>("event_source, " + name, sinks, connect);
+	for (auto sinks : nr_of_sinks)
+		benchmark<fc::pure::inline_event_source<int>>("inline_event_source, " + name, sinks, connect);
+}
+
+} // namespace
+
+int main()
+{
+	benchmark_all("mixed", connect_mixed{});
+	benchmark_all("24 byte capture", connect_large_capture{});
+	return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Compares the throughput of the thread pool based schedulers.
+ *
+ * Every tick a batch of small tasks is added to the scheduler,
+ * either one by one with add_task or at once with add_tasks.
+ * The tick ends as soon as all tasks of the batch have been executed.
+ */
+
+#include <benchmark.hpp>
+
+#include <flexcore/scheduler/parallelscheduler.hpp>
+#include <flexcore/scheduler/workstealingscheduler.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Adds tasks_per_tick tasks to scheduler and waits until all of them have been executed.
+ * \param batch scratch storage, tasks are added with add_tasks if given.
+ */
+void run_tick(fc::thread::scheduler& scheduler, size_t tasks_per_tick,
+		std::vector<fc::thread::scheduler::task_t>* batch)
+{
+	std::atomic<size_t> done{0};
+	auto task = [&done]
+	{
+		// a little bit of work, so that tasks are not entirely dominated by dispatching.
+		volatile unsigned sum = 0;
+		for (unsigned j = 0; j != 64; ++j)
+			sum = sum + j;
+		++done;
+	};
+
+	if (batch)
+	{
+		batch->clear();
+		for (size_t i = 0; i != tasks_per_tick; ++i)
+			batch->emplace_back(task);
+		scheduler.add_tasks(*batch);
+	}
+	else
+	{
+		for (size_t i = 0; i != tasks_per_tick; ++i)
+			scheduler.add_task(task);
+	}
+
+	while (done.load() != tasks_per_tick)
+		std::this_thread::yield();
+}
+
+template <class scheduler_t>
+void benchmark(const std::string& name, size_t tasks_per_tick, size_t ticks, bool batched)
+{
+	scheduler_t scheduler;
+	std::vector<fc::thread::scheduler::task_t> storage;
+	auto batch = batched ? &storage : nullptr;
+	run_tick(scheduler, tasks_per_tick, batch); // warm up threads and queues
+
+	const auto tick_ns = bench::mean_ns(ticks, [&] { run_tick(scheduler, tasks_per_tick, batch); });
+	const auto label = name + (batched ? " batched " : " ")
+			+ std::to_string(tasks_per_tick) + " tasks/tick";
+	bench::report(label, tick_ns / 1000.0, "us/tick");
+	bench::report(label, tasks_per_tick * 1e9 / tick_ns, "tasks/s");
+}
+
+} // namespace
+
+int main()
+{
+	std::cout << "worker threads: " << fc::thread::parallel_scheduler::num_threads() << "\n";
+	for (size_t tasks_per_tick : {1000u, 10000u})
+	{
+		const size_t ticks = tasks_per_tick == 1000u ? 500 : 100;
+		for (bool batched : {false, true})
+		{
+			benchmark<fc::thread::parallel_scheduler>(
+					"parallel_scheduler", tasks_per_tick, ticks, batched);
+			benchmark<fc::thread::work_stealing_scheduler>(
+					"work_stealing_scheduler", tasks_per_tick, ticks, batched);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,53 @@
+/*
+ * Compares the cost of sending an event through a fixed chain of connectables
+ * with event_source, inline_event_source, static_event_source and a hand-written function call.
+ *
+ * The chain consists of two transformations and a sink,
+ * connected to the source as [](int){} >> [](int){} >> sink.
+ * The sink stores into a volatile, so the compiler can not remove the chain,
+ * but can inline it as long as no type erasure is involved.
+ */
+
+#include <benchmark.hpp>
+
+#include <flexcore/core/connection.hpp>
+#include <flexcore/pure/event_sources.hpp>
+#include <flexcore/pure/static_event_source.hpp>
+
+namespace
+{
+
+using fc::operator>>;
+
+volatile long result = 0;
+
+auto add_one = [](int v) { return v + 1; };
+auto twice = [](int v) { return v * 2; };
+auto store = [](int v) { result = v; };
+
+template <class fire_t>
+void benchmark(const std::string& name, fire_t fire)
+{
+	int event = 0;
+	const auto fire_ns = bench::mean_ns(10000000, [&] { fire(++event); });
+	bench::report(name, fire_ns, "ns/event");
+}
+
+} // namespace
+
+int main()
+{
+	benchmark("hand-written function call", [](int v) { store(twice(add_one(v))); });
+
+	auto static_source = fc::pure::static_event_source<int>{}.connect(add_one >> twice >> store);
+	benchmark("static_event_source", [&](int v) { static_source.fire(v); });
+
+	fc::pure::event_source<int> source;
+	source >> add_one >> twice >> store;
+	benchmark("event_source", [&](int v) { source.fire(v); });
+
+	fc::pure::inline_event_source<int> inline_source;
+	inline_source >> add_one >> twice >> store;
+	benchmark("inline_event_source", [&](int v) { inline_source.fire(v); });
+	return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Compares the cost of dispatching tasks through a queue
+ * with std::function, as scheduler::task_t used to be, and with small_function.
+ *
+ * Every task is wrapped, pushed into a queue, taken out again and executed,
+ * as parallel_scheduler does with the tasks cycle_control adds every tick.
+ * std::function is copied out of the queue as before, small_function is moved.
+ */
+
+#include <benchmark.hpp>
+
+#include <flexcore/core/small_function.hpp>
+
+#include <array>
+#include <functional>
+#include <queue>
+
+namespace
+{
+
+struct periodic_work
+{
+	unsigned counter = 0;
+	void operator()() { ++counter; }
+};
+
+/// Pushes tasks_per_run tasks created by make_task through a queue and executes them.
+template <class task_t, class make_t, class take_t>
+void run(size_t tasks_per_run, make_t make_task, take_t take)
+{
+	std::queue<task_t> queue;
+	for (size_t i = 0; i != tasks_per_run; ++i)
+		queue.push(make_task());
+	while (!queue.empty())
+	{
+		task_t task = take(queue.front());
+		queue.pop();
+		task();
+	}
+}
+
+template <class task_t, class make_t, class take_t>
+void benchmark(const std::string& name, make_t make_task, take_t take)
+{
+	const size_t tasks_per_run = 1000;
+	const auto run_ns = bench::mean_ns(2000, [&] { run<task_t>(tasks_per_run, make_task, take); });
+	bench::report(name, tasks_per_run * 1e9 / run_ns, "tasks/s");
+}
+
+} // namespace
+
+int main()
+{
+	using std_task = std::function<void()>;
+	using small_task = fc::small_function<void()>;
+	auto copy = [](auto& task) { return task; };
+	auto move = [](auto& task) { return std::move(task); };
+
+	periodic_work work;
+	// same capture as the task cycle_control creates for every periodic_task.
+	auto by_reference = [&work] { return [&work] { work(); }; };
+	benchmark<std_task>("std::function, copy out of queue", by_reference, copy);
+	benchmark<std_task>("std::function, move out of queue", by_reference, move);
+	benchmark<small_task>("small_function", by_reference, move);
+
+	// a capture too large for the small buffer of std::function
+	std::array<void*, 3> payload{{&work, &work, &work}};
+	auto large = [&payload] { return [payload] { (*static_cast<periodic_work*>(payload[0]))(); }; };
+	benchmark<std_task>("std::function, 24 byte capture", large, copy);
+	benchmark<small_task>("small_function, 24 byte capture", large, move);
+	return 0;
+}
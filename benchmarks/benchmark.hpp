@@ -0,0 +1,35 @@
+#ifndef BENCHMARKS_BENCHMARK_HPP_
+#define BENCHMARKS_BENCHMARK_HPP_
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench
+{
+
+using clock = std::chrono::steady_clock;
+
+/// Runs f repetitions times and returns the mean duration of a single run in nanoseconds.
+template <class fun_t>
+double mean_ns(size_t repetitions, fun_t&& f)
+{
+	const auto start = clock::now();
+	for (size_t i = 0; i != repetitions; ++i)
+		f();
+	const auto elapsed = clock::now() - start;
+	return std::chrono::duration<double, std::nano>(elapsed).count() / repetitions;
+}
+
+/// Prints a single measurement as an aligned table row.
+inline void report(const std::string& name, double value, const std::string& unit)
+{
+	std::cout << std::left << std::setw(48) << name
+	          << std::right << std::setw(14) << std::fixed << std::setprecision(1) << value
+	          << " " << unit << "\n";
+}
+
+} // namespace bench
+
+#endif /* BENCHMARKS_BENCHMARK_HPP_ */
@@ -0,0 +1,210 @@
+#ifndef SRC_CORE_SMALL_FUNCTION_HPP_
+#define SRC_CORE_SMALL_FUNCTION_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fc
+{
+
+template <class signature, size_t buffer_size = 3 * sizeof(void*)>
+class small_function;
+
+/**
+ * \brief move-only polymorphic function wrapper with inline storage.
+ *
+ * Behaves like std::function, but is not copyable.
+ * Callables which fit into buffer_size bytes and are nothrow move constructible
+ * are stored inside the object itself and never allocate.
+ * Larger callables are stored on the heap.
+ * As it is move-only, it can store move-only callables.
+ *
+ * \tparam signature function type, for example void(int)
+ * \tparam buffer_size size of the inline storage in bytes
+ *
+ * \invariant vtable == nullptr if and only if no callable is stored.
+ */
+template <class result_t, class... args_t, size_t buffer_size>
+class small_function<result_t(args_t...), buffer_size>
+{
+public:
+	small_function() noexcept = default;
+	small_function(std::nullptr_t) noexcept {}
+
+	template <class callable,
+	          class = std::enable_if_t<!std::is_same<std::decay_t<callable>, small_function>{}>>
+	small_function(callable&& f)
+	{
+		assign(std::forward<callable>(f));
+	}
+
+	small_function(small_function&& other) noexcept
+	{
+		move_from(other);
+	}
+
+	small_function& operator=(small_function&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			move_from(other);
+		}
+		return *this;
+	}
+
+	small_function& operator=(std::nullptr_t) noexcept
+	{
+		reset();
+		return *this;
+	}
+
+	small_function(const small_function&) = delete;
+	small_function& operator=(const small_function&) = delete;
+
+	~small_function() { reset(); }
+
+	explicit operator bool() const noexcept { return vtable != nullptr; }
+
+	/// \throws std::bad_function_call if no callable is stored.
+	result_t operator()(args_t... args)
+	{
+		if (!vtable)
+			throw std::bad_function_call{};
+		return vtable->invoke(&storage, std::forward<args_t>(args)...);
+	}
+
+	/// true if callables of type callable are stored without heap allocation.
+	template <class callable>
+	static constexpr bool stored_inline()
+	{
+		return sizeof(callable) <= buffer_size
+				&& alignof(callable) <= alignof(storage_t)
+				&& std::is_nothrow_move_constructible<callable>{};
+	}
+
+private:
+	using storage_t = std::aligned_storage_t<buffer_size>;
+
+	/// type erased operations on the stored callable.
+	struct operations
+	{
+		result_t (*invoke)(storage_t*, args_t&&...);
+		/// move constructs the callable from source into target and destroys the source.
+		void (*relocate)(storage_t* source, storage_t* target) noexcept;
+		void (*destroy)(storage_t*) noexcept;
+	};
+
+	template <class callable>
+	struct inline_operations
+	{
+		static callable& get(storage_t* s)
+		{
+			return *reinterpret_cast<callable*>(s);
+		}
+		static result_t invoke(storage_t* s, args_t&&... args)
+		{
+			return get(s)(std::forward<args_t>(args)...);
+		}
+		static void relocate(storage_t* source, storage_t* target) noexcept
+		{
+			new (target) callable(std::move(get(source)));
+			get(source).~callable();
+		}
+		static void destroy(storage_t* s) noexcept { get(s).~callable(); }
+		static constexpr operations table{&invoke, &relocate, &destroy};
+	};
+
+	template <class callable>
+	struct heap_operations
+	{
+		static callable*& get(storage_t* s)
+		{
+			return *reinterpret_cast<callable**>(s);
+		}
+		static result_t invoke(storage_t* s, args_t&&... args)
+		{
+			return (*get(s))(std::forward<args_t>(args)...);
+		}
+		static void relocate(storage_t* source, storage_t* target) noexcept
+		{
+			new (target) callable*(get(source));
+		}
+		static void destroy(storage_t* s) noexcept { delete get(s); }
+		static constexpr operations table{&invoke, &relocate, &destroy};
+	};
+
+	template <class callable>
+	void assign(callable&& f)
+	{
+		using stored_t = std::decay_t<callable>;
+		if (is_empty(f))
+			return;
+		assign(std::forward<callable>(f),
+		       std::integral_constant<bool, stored_inline<stored_t>()>{});
+	}
+
+	template <class callable>
+	void assign(callable&& f, std::true_type /*inline*/)
+	{
+		using stored_t = std::decay_t<callable>;
+		new (&storage) stored_t(std::forward<callable>(f));
+		vtable = &inline_operations<stored_t>::table;
+	}
+
+	template <class callable>
+	void assign(callable&& f, std::false_type /*inline*/)
+	{
+		using stored_t = std::decay_t<callable>;
+		static_assert(sizeof(stored_t*) <= buffer_size, "buffer too small for a pointer");
+		new (&storage) stored_t*(new stored_t(std::forward<callable>(f)));
+		vtable = &heap_operations<stored_t>::table;
+	}
+
+	void move_from(small_function& other) noexcept
+	{
+		assert(!vtable);
+		if (!other.vtable)
+			return;
+		other.vtable->relocate(&other.storage, &storage);
+		vtable = other.vtable;
+		other.vtable = nullptr;
+	}
+
+	void reset() noexcept
+	{
+		if (!vtable)
+			return;
+		vtable->destroy(&storage);
+		vtable = nullptr;
+	}
+
+	/// empty function pointers and std::functions result in an empty small_function.
+	template <class T>
+	static bool is_empty(const T&) { return false; }
+	template <class T>
+	static bool is_empty(T* f) { return f == nullptr; }
+	template <class T>
+	static bool is_empty(const std::function<T>& f) { return !f; }
+
+	storage_t storage;
+	const operations* vtable = nullptr;
+};
+
+template <class result_t, class... args_t, size_t buffer_size>
+template <class callable>
+constexpr typename small_function<result_t(args_t...), buffer_size>::operations
+small_function<result_t(args_t...), buffer_size>::inline_operations<callable>::table;
+
+template <class result_t, class... args_t, size_t buffer_size>
+template <class callable>
+constexpr typename small_function<result_t(args_t...), buffer_size>::operations
+small_function<result_t(args_t...), buffer_size>::heap_operations<callable>::table;
+
+} // namespace fc
+
+#endif /* SRC_CORE_SMALL_FUNCTION_HPP_ */
@@ -2,8 +2,11 @@
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graphviz.hpp>
+#include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
 #include <mutex>
+#include <tuple>
 
 namespace fc
 {
@@ -16,6 +19,7 @@ struct vertex
 	std::string name;
 	std::size_t uuid;
 	std::size_t region;
+	const parallel_region* region_ptr;
 };
 
 /// Class containing the information of a connection/edge in the boost graph.
@@ -92,14 +96,16 @@ void connection_graph::impl::add_connection(const graph_node_properties& source_
 		vertex_map.emplace(
 		    source_node.get_id(),
 		    boost::add_vertex(vertex{source_node.name(), hash_value(source_node.get_id()),
-		                             region_to_hash(source_node.region())},
+		                             region_to_hash(source_node.region()),
+		                             source_node.region()},
 		                      dataflow_graph));
 
 	if (vertex_map.find(sink_node.get_id()) == vertex_map.end())
 		vertex_map.emplace(
 		    sink_node.get_id(),
 		    boost::add_vertex(vertex{sink_node.name(), hash_value(sink_node.get_id()),
-		                             region_to_hash(sink_node.region())},
+		                             region_to_hash(sink_node.region()),
+		                             sink_node.region()},
 		                      dataflow_graph));
 
 	boost::add_edge(vertex_map[source_node.get_id()],
@@ -112,6 +118,54 @@ void connection_graph::add_connection(const graph_node_properties& source_node,
 	pimpl->add_connection(source_node, sink_node);
 }
 
+std::vector<region_dependency> connection_graph::region_dependencies() const
+{
+	std::lock_guard<std::mutex> lock(pimpl->graph_mutex);
+	const auto& graph = pimpl->dataflow_graph;
+	std::vector<region_dependency> dependencies;
+	std::vector<dataflow_graph_t::vertex_descriptor> open;
+	std::vector<bool> visited;
+	for (auto v : boost::make_iterator_range(boost::vertices(graph)))
+	{
+		const auto producer = graph[v].region_ptr;
+		if (!producer)
+			continue;
+
+		// follow connections through nodes without region, like named lambdas,
+		// until nodes with region are reached.
+		visited.assign(boost::num_vertices(graph), false);
+		open.assign(1, v);
+		while (!open.empty())
+		{
+			const auto current = open.back();
+			open.pop_back();
+			for (auto next : boost::make_iterator_range(boost::adjacent_vertices(current, graph)))
+			{
+				if (visited[next])
+					continue;
+				visited[next] = true;
+				const auto consumer = graph[next].region_ptr;
+				if (!consumer)
+					open.push_back(next);
+				else if (consumer != producer)
+					dependencies.push_back(region_dependency{producer, consumer});
+			}
+		}
+	}
+
+	auto as_tuple = [](const region_dependency& d) { return std::tie(d.producer, d.consumer); };
+	std::sort(begin(dependencies), end(dependencies), [&](const auto& lhs, const auto& rhs)
+			{
+				return as_tuple(lhs) < as_tuple(rhs);
+			});
+	dependencies.erase(std::unique(begin(dependencies), end(dependencies),
+			[&](const auto& lhs, const auto& rhs)
+			{
+				return as_tuple(lhs) == as_tuple(rhs);
+			}), end(dependencies));
+	return dependencies;
+}
+
 void connection_graph::clear_graph()
 {
 	std::lock_guard<std::mutex> lock(pimpl->graph_mutex);
@@ -6,6 +6,7 @@
 #include <flexcore/scheduler/parallelregion.hpp>
 
 #include <map>
+#include <vector>
 
 namespace fc
 {
@@ -64,6 +65,15 @@ public:
 	/// Prints current state of the abstract graph in graphviz format to stream.
 	void print(std::ostream& stream);
 
+	/**
+	 * \brief dependencies between regions given by the connections in the graph.
+	 *
+	 * Contains one entry for every pair of distinct regions,
+	 * which are connected by at least one connection.
+	 * Nodes without region are ignored.
+	 */
+	std::vector<region_dependency> region_dependencies() const;
+
 	/// deleted the current graph
 	void clear_graph();
 
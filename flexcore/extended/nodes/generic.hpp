@@ -133,7 +133,7 @@ private:
 		assert(in_ports.find(port) != end(in_ports));
 
 		if (port == switch_state.get())
-			out().fire(event);
+			out().fire(std::move(event));
 	}
 };
 
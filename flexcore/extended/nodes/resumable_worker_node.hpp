@@ -0,0 +1,122 @@
+#ifndef SRC_NODES_RESUMABLE_WORKER_NODE_HPP_
+#define SRC_NODES_RESUMABLE_WORKER_NODE_HPP_
+
+#include <flexcore/scheduler/clock.hpp>
+#include <flexcore/extended/base_node.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+
+namespace fc
+{
+
+/**
+ * \brief wall clock time a resumable job may spend within the current work tick.
+ */
+class work_budget
+{
+public:
+	typedef wall_clock::steady clock;
+
+	explicit work_budget(clock::duration budget)
+		: deadline(clock::now() + budget)
+	{
+	}
+
+	/// true if the job should yield and continue in the next work tick.
+	bool exhausted() const { return clock::now() >= deadline; }
+	clock::duration remaining() const
+	{
+		return std::max(clock::duration::zero(), deadline - clock::now());
+	}
+
+private:
+	clock::time_point deadline;
+};
+
+/**
+ * \brief node which spreads long running jobs over several work ticks of its region.
+ *
+ * A job is a resumable state machine:
+ * every call does one step of the work and returns true, once the job is finished.
+ * On every work tick the node calls the current job until it is finished
+ * or the budget per tick is exhausted, the job resumes with its next step on the next tick.
+ * Jobs may also check the budget themselves, to yield within a step.
+ * At least one step is executed per tick, thus jobs progress even if a step exceeds the budget.
+ *
+ * Jobs are executed one after another in the order they have been added.
+ * As the node is executed by its region, jobs need to be added from within the region.
+ * \ingroup nodes
+ */
+class resumable_worker_node : public tree_base_node
+{
+public:
+	/// does one step of a job, returns true if the job is finished.
+	typedef std::function<bool(const work_budget&)> job_t;
+
+	/**
+	 * \param budget_per_tick wall clock time the node may spend on jobs in a single tick.
+	 * \param node node arguments, the node works on the work tick of its region.
+	 */
+	resumable_worker_node(wall_clock::steady::duration budget_per_tick, const node_args& node)
+		: tree_base_node(node)
+		, finished_(this)
+		, budget_per_tick(budget_per_tick)
+	{
+		region()->work_tick() >> [this] { work(); };
+	}
+
+	/// queues job, it starts once all jobs added before have finished.
+	void add_job(job_t job) { jobs.push_back(std::move(job)); }
+	/// number of unfinished jobs including the one in progress.
+	size_t nr_of_jobs() const { return jobs.size(); }
+	/// event source of type void, fires in the work tick in which a job has finished.
+	auto& finished() { return finished_; }
+
+private:
+	void work()
+	{
+		if (jobs.empty())
+			return;
+		const work_budget budget{budget_per_tick};
+		do
+		{
+			if (jobs.front()(budget))
+			{
+				jobs.pop_front();
+				finished_.fire();
+			}
+		} while (!jobs.empty() && !budget.exhausted());
+	}
+
+	event_source<void> finished_;
+	wall_clock::steady::duration budget_per_tick;
+	std::deque<job_t> jobs;
+};
+
+/**
+ * \brief creates a job which calls body(i) for all i in [0, count).
+ *
+ * The loop yields whenever the budget is exhausted
+ * and continues with the next index on the next work tick.
+ */
+template <class body_t>
+resumable_worker_node::job_t make_loop_job(size_t count, body_t body)
+{
+	auto next = std::make_shared<size_t>(0);
+	return [count, body, next](const work_budget& budget) mutable
+	{
+		while (*next != count)
+		{
+			body((*next)++);
+			if (budget.exhausted())
+				break;
+		}
+		return *next == count;
+	};
+}
+
+} //namespace fc
+#endif /* SRC_NODES_RESUMABLE_WORKER_NODE_HPP_ */
@@ -1,8 +1,11 @@
 #ifndef SRC_PORTS_CONNECTION_BUFFER_HPP_
 #define SRC_PORTS_CONNECTION_BUFFER_HPP_
 
+#include <atomic>
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 
 #include <flexcore/pure/pure_ports.hpp>
 #include <flexcore/extended/ports/token_tags.hpp>
@@ -80,7 +83,7 @@ public:
 		: switch_active_tick_([this] { switch_active_buffers(); })
 		, switch_passive_tick_([this] { switch_passive_buffers(); })
 		, in_send_tick( [this](){ send_events(); } )
-		, in_event_port( [this](event_t in_event) { intern_buffer.push_back(in_event);})
+		, in_event_port( [this](event_t in_event) { intern_buffer.push_back(std::move(in_event));})
 		, intern_buffer()
 		, extern_buffer()
 		, read(false)
@@ -96,6 +99,11 @@ public:
 	auto& switch_passive_tick() { return switch_passive_tick_; };
 	/// event in port of type void, fires outgoing buffer
 	auto& work_tick() { return in_send_tick; };
+	/**
+	 * \brief sets the flag, which is raised whenever events are passed on to the passive side.
+	 * Used to activate event driven regions, see parallel_region::set_event_driven.
+	 */
+	void set_pending_flag(std::shared_ptr<std::atomic<bool>> flag) { pending = std::move(flag); }
 
 	in_port_t& in() override { return in_event_port; }
 	out_port_t& out() override { return out_event_port; }
@@ -103,13 +111,17 @@ public:
 protected:
 	void switch_active_buffers()
 	{
+		if (pending && !intern_buffer.empty())
+			pending->store(true, std::memory_order_release);
 		// If middle buffer has been switched with outgoing_buffer, then we can swap the incoming
 		// buffers without data loss. If middle buffer has not been read then data needs to be
 		// appended.
 		if (read)
 			swap(intern_buffer, middle_buffer);
 		else
-			middle_buffer.insert(end(middle_buffer), begin(intern_buffer), end(intern_buffer));
+			middle_buffer.insert(end(middle_buffer),
+					std::make_move_iterator(begin(intern_buffer)),
+					std::make_move_iterator(end(intern_buffer)));
 		read = false;
 		intern_buffer.clear();
 	}
@@ -125,12 +137,15 @@ protected:
 
 	/**
 	 * \brief sends all events stored in outgoing buffer to targets
+	 *
+	 * All events are sent as a single batch.
+	 * They are moved out of the buffer, as they are cleared afterwards anyway.
 	 * \post extern_buffer is empty
 	 */
 	void send_events()
 	{
-		for (event_t e : extern_buffer)
-			out_event_port.fire(e);
+		if (!extern_buffer.empty())
+			send_events(contiguous_buffer{});
 
 		// delete content of extern buffer, do not change capacity,
 		// since we want to avoid allocations in next cycle.
@@ -138,6 +153,21 @@ protected:
 		assert(extern_buffer.empty());
 	}
 
+	/// std::vector<bool> does not store contiguous bools, which could be viewed by an event_span.
+	typedef std::integral_constant<bool, !std::is_same<event_t, bool>{}> contiguous_buffer;
+
+	void send_events(std::true_type /*contiguous*/)
+	{
+		out_event_port.fire_batch(pure::event_span<event_t>(extern_buffer));
+	}
+
+	/// sends events one by one, sinks expecting batches receive batches of one.
+	void send_events(std::false_type /*contiguous*/)
+	{
+		for (event_t e : extern_buffer)
+			out_event_port.fire(e);
+	}
+
 	pure::event_sink<void> switch_active_tick_;
 	pure::event_sink<void> switch_passive_tick_;
 	pure::event_sink<void> in_send_tick;
@@ -149,6 +179,7 @@ protected:
 	buffer_t extern_buffer;
 	buffer_t middle_buffer;
 	bool read;
+	std::shared_ptr<std::atomic<bool>> pending;
 };
 
 /**
@@ -181,6 +212,8 @@ public:
 	auto& switch_passive_tick() { return switch_passive_tick_; };
 	/// event in port of type void, fires out port once for each event stored.
 	auto& work_tick() { return in_send_tick; };
+	/// \see event_buffer::set_pending_flag
+	void set_pending_flag(std::shared_ptr<std::atomic<bool>> flag) { pending = std::move(flag); }
 
 	in_port_t& in() override { return in_event_port; }
 	out_port_t& out() override { return out_event_port; }
@@ -188,6 +221,8 @@ public:
 protected:
 	void switch_active_buffers()
 	{
+		if (pending && intern_buffer != 0)
+			pending->store(true, std::memory_order_release);
 		if (read)
 			middle_buffer = intern_buffer;
 		else
@@ -227,6 +262,7 @@ protected:
 	size_t extern_buffer;
 	size_t middle_buffer;
 	bool read;
+	std::shared_ptr<std::atomic<bool>> pending;
 };
 
 /// Implementation of buffer_interface, which directly forwards state.
@@ -42,8 +42,7 @@ struct buffer_factory
 			auto result_buffer =
 					std::make_shared<typename buffer<result_t, tag>::type>();
 
-			active.region().switch_tick() >> result_buffer->switch_active_tick();
-			passive.region().switch_tick() >> result_buffer->switch_passive_tick();
+			connect_switch_ticks(*result_buffer, active.region(), passive.region(), tag{});
 			passive.region().work_tick() >> result_buffer->work_tick();
 
 			return result_buffer;
@@ -51,6 +50,26 @@ struct buffer_factory
 		else
 			return std::make_shared<typename no_buffer<result_t, tag>::type>();
 	}
+
+private:
+	/// events flow from the active to the passive region, the active region writes the buffer.
+	template<class buffer_t>
+	static void connect_switch_ticks(buffer_t& buffer,
+	        parallel_region& active, parallel_region& passive, event_tag)
+	{
+		active.output_switch_tick() >> buffer.switch_active_tick();
+		passive.switch_tick() >> buffer.switch_passive_tick();
+		buffer.set_pending_flag(passive.pending_events());
+	}
+
+	/// states flow from the passive to the active region, the passive region writes the buffer.
+	template<class buffer_t>
+	static void connect_switch_ticks(buffer_t& buffer,
+	        parallel_region& active, parallel_region& passive, state_tag)
+	{
+		active.switch_tick() >> buffer.switch_active_tick();
+		passive.output_switch_tick() >> buffer.switch_passive_tick();
+	}
 };
 
 /**
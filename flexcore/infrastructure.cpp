@@ -1,10 +1,25 @@
 #include <flexcore/infrastructure.hpp>
 #include <flexcore/scheduler/parallelscheduler.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 #include <stdexcept>
 
 namespace fc
 {
+namespace
+{
+/// tick rate of the root region, the multiple of tick_length closest to the medium tick.
+virtual_clock::steady::duration root_tick_rate(wall_clock::steady::duration tick_length)
+{
+	const auto medium = std::chrono::duration_cast<wall_clock::steady::duration>(
+			thread::cycle_control::medium_tick);
+	const auto nr_of_ticks = std::max<wall_clock::steady::rep>(
+			1, (medium + tick_length / 2) / tick_length);
+	return std::chrono::duration_cast<virtual_clock::steady::duration>(tick_length * nr_of_ticks);
+}
+}
+
 namespace detail {
 class scheduled_region : public fc::parallel_region
 {
@@ -29,12 +44,22 @@ class region_factory : public std::enable_shared_from_this<region_factory>
 public:
 	region_factory(thread::cycle_control& scheduler) : scheduler(scheduler) {}
 
-	/// Creates a new region and connects it to the scheduler with a periodic task.
+	/**
+	 * \brief Creates a new region and connects it to the scheduler with a periodic task.
+	 * The region is added to the offload executor, if there is one.
+	 */
 	std::shared_ptr<parallel_region> new_region(const std::string& name,
 	                                            const virtual_clock::steady::duration& tick_rate);
+	/**
+	 * \brief adds all existing and future regions to executor.
+	 * \pre the scheduler is not running.
+	 */
+	void set_offload_executor(thread::offload_executor* executor);
 
 private:
 	thread::cycle_control& scheduler;
+	std::vector<std::weak_ptr<parallel_region>> regions;
+	thread::offload_executor* offload = nullptr;
 };
 
 std::shared_ptr<parallel_region>
@@ -53,8 +78,25 @@ region_factory::new_region(const std::string& name,
 	auto region = std::make_shared<scheduled_region>(name, shared_from_this());
 	auto tick_cycle = fc::thread::periodic_task(region);
 	scheduler.add_task(std::move(tick_cycle),tick_rate);
+	if (offload)
+		offload->add_region(*region);
+	regions.erase(std::remove_if(regions.begin(), regions.end(),
+			[](const auto& existing) { return existing.expired(); }), regions.end());
+	regions.push_back(region);
 	return region;
 }
+
+void region_factory::set_offload_executor(thread::offload_executor* executor)
+{
+	offload = executor;
+	if (!offload)
+		return;
+	for (const auto& existing : regions)
+	{
+		if (auto region = existing.lock())
+			offload->add_region(*region);
+	}
+}
 } // namespace detail
 
 std::shared_ptr<parallel_region>
@@ -65,16 +107,78 @@ infrastructure::add_region(const std::string& name,
 }
 
 infrastructure::infrastructure()
-    : scheduler(std::make_unique<fc::thread::parallel_scheduler>())
+    : infrastructure(std::make_unique<fc::thread::parallel_scheduler>())
+{
+}
+
+infrastructure::infrastructure(const thread::thread_pool_config& config)
+    : infrastructure(std::make_unique<fc::thread::parallel_scheduler>(config))
+{
+}
+
+infrastructure::infrastructure(std::unique_ptr<thread::scheduler> task_scheduler,
+                               wall_clock::steady::duration tick_length)
+    : scheduler(std::move(task_scheduler), tick_length)
     , region_maker(std::make_shared<detail::region_factory>(scheduler))
     , graph()
-    , forest_root(graph, "root", add_region("root_region", thread::cycle_control::medium_tick))
+    , forest_root(graph, "root", add_region("root_region", root_tick_rate(scheduler.tick_length())))
 {
 }
 
 infrastructure::~infrastructure()
 {
 	stop_scheduler();
+	region_maker->set_offload_executor(nullptr);
+}
+
+virtual_clock::domain& infrastructure::use_own_clock_domain()
+{
+	scheduler.set_clock_domain(std::make_shared<virtual_clock::domain>());
+	return scheduler.clock_domain();
+}
+
+thread::offload_executor& infrastructure::offload_executor()
+{
+	std::lock_guard<std::mutex> lock(offload_mutex);
+	if (!offload)
+	{
+		if (scheduler_running)
+			throw std::runtime_error{"Offload executor cannot be created while running"};
+		offload = std::make_unique<thread::offload_executor>();
+		region_maker->set_offload_executor(offload.get());
+	}
+	return *offload;
+}
+
+thread::offload_executor& infrastructure::use_offload_executor(
+		const thread::thread_pool_config& config, size_t capacity)
+{
+	std::lock_guard<std::mutex> lock(offload_mutex);
+	if (offload)
+		throw std::runtime_error{"Offload executor has already been created"};
+	if (scheduler_running)
+		throw std::runtime_error{"Offload executor cannot be created while running"};
+	offload = std::make_unique<thread::offload_executor>(config, capacity);
+	region_maker->set_offload_executor(offload.get());
+	return *offload;
+}
+
+void infrastructure::start_scheduler(bool fast)
+{
+	if (dependency_ordered)
+		scheduler.set_region_dependencies(graph.region_dependencies());
+	{
+		std::lock_guard<std::mutex> lock(offload_mutex);
+		scheduler_running = true;
+	}
+	scheduler.start(fast);
+}
+
+void infrastructure::stop_scheduler()
+{
+	scheduler.stop();
+	std::lock_guard<std::mutex> lock(offload_mutex);
+	scheduler_running = false;
 }
 
 void infrastructure::iterate_main_loop()
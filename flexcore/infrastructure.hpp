@@ -3,6 +3,10 @@
 
 #include <flexcore/extended/base_node.hpp>
 #include <flexcore/scheduler/cyclecontrol.hpp>
+#include <flexcore/scheduler/offloadexecutor.hpp>
+#include <flexcore/scheduler/threadconfig.hpp>
+
+#include <mutex>
 
 namespace fc
 {
@@ -13,7 +17,18 @@ class region_factory;
 class infrastructure
 {
 public:
+	/// Creates infrastructure with a parallel_scheduler using one thread per hardware thread.
 	infrastructure();
+	/// Creates infrastructure with a parallel_scheduler whose threads are configured by config.
+	explicit infrastructure(const thread::thread_pool_config& config);
+	/**
+	 * \brief Creates infrastructure which executes its regions with the given scheduler.
+	 * \param tick_length base period of the cyclic execution, see thread::cycle_control.
+	 * \pre scheduler != nullptr
+	 */
+	explicit infrastructure(std::unique_ptr<thread::scheduler> scheduler,
+	                        wall_clock::steady::duration tick_length =
+	                                thread::cycle_control::min_tick_length);
 	~infrastructure();
 
 	std::shared_ptr<parallel_region> add_region(const std::string& name,
@@ -27,8 +42,63 @@ public:
 		forest_root.print_forest(forest_out);
 	}
 	void infinite_main_loop();
-	void start_scheduler(bool fast = false) { scheduler.start(fast); }
-	void stop_scheduler() { scheduler.stop(); }
+	/**
+	 * \brief executes regions in the order of the connections between them.
+	 * The dependencies are taken from the connection graph when the scheduler is started.
+	 * \see thread::cycle_control::set_region_dependencies
+	 */
+	void order_regions_by_dependencies() { dependency_ordered = true; }
+	/**
+	 * \brief gives this infrastructure a virtual clock independent of all others.
+	 *
+	 * Allows to run several simulations side by side in one process.
+	 * Use a virtual_clock::domain::scope with the returned domain,
+	 * to read the time of this infrastructure outside of its regions.
+	 * \throws std::runtime_error if the scheduler is already running.
+	 */
+	virtual_clock::domain& use_own_clock_domain();
+	/// clock domain advanced by the scheduler of this infrastructure.
+	virtual_clock::domain& clock_domain() const { return scheduler.clock_domain(); }
+	void start_scheduler(bool fast = false);
+	void stop_scheduler();
+	/**
+	 * \brief executor for blocking work of nodes, outside of the cyclic schedule.
+	 * Created with a default configuration on first use,
+	 * unless use_offload_executor has been called before.
+	 * All regions of this infrastructure are added to the executor.
+	 * \throws std::runtime_error if it would be created while the scheduler is running.
+	 */
+	thread::offload_executor& offload_executor();
+	/**
+	 * \brief creates the offload executor with the given configuration.
+	 * All regions of this infrastructure are added to the executor.
+	 * \throws std::runtime_error if the offload executor has already been created,
+	 * or if the scheduler is running.
+	 */
+	thread::offload_executor& use_offload_executor(const thread::thread_pool_config& config,
+			size_t capacity = thread::offload_executor::default_capacity);
+	/**
+	 * \brief sets the reaction to overruns of region.
+	 * \throws std::invalid_argument if region is not executed by this infrastructure.
+	 * \throws std::runtime_error if the scheduler is already running.
+	 */
+	void set_overrun_policy(const parallel_region& region, thread::overrun_policy policy)
+	{
+		scheduler.set_overrun_policy(region, policy);
+	}
+	/// timing statistics of all regions.
+	std::vector<thread::cycle_control::task_info> statistics() const
+	{
+		return scheduler.statistics();
+	}
+	/**
+	 * \brief timing statistics of a single region.
+	 * \throws std::invalid_argument if region is not executed by this infrastructure.
+	 */
+	thread::task_statistics statistics(const parallel_region& region) const
+	{
+		return scheduler.statistics(region);
+	}
 	void iterate_main_loop();
 
 private:
@@ -36,6 +106,12 @@ private:
 	std::shared_ptr<detail::region_factory> region_maker;
 	graph::connection_graph graph;
 	forest_owner forest_root;
+	bool dependency_ordered = false;
+	std::mutex offload_mutex;
+	/// guarded by offload_mutex, regions are only added to the executor while stopped.
+	bool scheduler_running = false;
+	/// destroyed before the regions, thus no completion is posted to a destroyed region.
+	std::unique_ptr<thread::offload_executor> offload;
 };
 
 } /* namespace fc */
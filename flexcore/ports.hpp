@@ -58,6 +58,13 @@ using event_sink = default_mixin<pure::event_sink<data_t>>;
 template<class data_t>
 using event_source = default_mixin<pure::event_source<data_t>>;
 
+/**
+ * \brief Default broadcast_event_source port
+ * \ingroup ports
+ */
+template<class data_t>
+using broadcast_event_source = default_mixin<pure::broadcast_event_source<data_t>>;
+
 /**
  * \brief Default state_sink port
  * \ingroup ports
@@ -5,6 +5,7 @@
 
 #include <flexcore/core/connection.hpp>
 #include <flexcore/pure/port_connection.hpp>
+#include <flexcore/pure/detail/port_traits.hpp>
 
 namespace fc
 {
@@ -47,7 +48,12 @@ struct active_source_first
 	struct sink
 	{
 		typedef sink_t type;
-		using result_t = typename detail::result_of_fwd<sink_t, result_of_t<source_t>>::type::type;
+		// sinks for batches of events are called with spans of events.
+		using result_t = typename std::conditional_t<
+				is_batch_handler<std::decay_t<sink_t>, result_of_t<source_t>>{},
+				detail::result_of_fwd<sink_t, pure::event_span<const result_of_t<source_t>>>,
+				detail::result_of_fwd<sink_t, result_of_t<source_t>>
+			>::type::type;
 	};
 	template<class source_t, class sink_t>
 	auto operator()(source_t&& source, sink_t&& sink)
@@ -186,8 +192,8 @@ struct active_passive_connect_impl
 		std::enable_if_t
 			<	!is_instantiation_of< active_connection_proxy,std::decay_t<active_t>>{}
 				&&	(	(	is_active_source<std::decay_t<active_t>>{}
-						&& !fc::is_passive_sink_for<std::decay_t<passive_t>,
-						                            typename std::decay_t<active_t>::result_t>{}
+						&& !is_passive_sink_for_events<std::decay_t<passive_t>,
+						                               typename std::decay_t<active_t>::result_t>{}
 						)
 					||	(	fc::is_active_sink<std::decay_t<active_t>>{}
 						&& !fc::is_passive_source<std::decay_t<passive_t>>{}
@@ -217,8 +223,8 @@ struct active_passive_connect_impl
 		std::enable_if_t
 			<	!is_instantiation_of< active_connection_proxy, std::decay_t<active_t>>{}
 				&&	(	(	is_active_source<std::decay_t<active_t>>{}
-						&& fc::is_passive_sink_for<std::decay_t<passive_t>,
-						                            typename std::decay_t<active_t>::result_t>{}
+						&& is_passive_sink_for_events<std::decay_t<passive_t>,
+						                              typename std::decay_t<active_t>::result_t>{}
 					)
 					||	(	fc::is_active_sink<std::decay_t<active_t>>{}
 						&&	fc::is_passive_source<std::decay_t<passive_t>>{}
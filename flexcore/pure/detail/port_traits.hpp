@@ -9,6 +9,7 @@
 #define SRC_PORTS_PORT_TRAITS_HPP_
 
 #include <flexcore/core/traits.hpp>
+#include <flexcore/pure/event_span.hpp>
 
 // A collection of port specific meta functions and traits.
 
@@ -40,6 +41,39 @@ class is_derived_from
 public:
 	static constexpr bool value = sizeof(test(std::declval<port_t>())) == sizeof(yes);
 };
+
+template <class conn_t, class event_t>
+struct batch_callable : is_passive_sink_for<conn_t, pure::event_span<const event_t>>
+{
+};
+
+/**
+ * \brief true if conn_t is a sink for batches of events instead of single events.
+ *
+ * Connectables callable with single events are never batch handlers.
+ * They are checked first, as generic lambdas might fail hard on a span of events.
+ */
+template <class conn_t, class event_t, class enable = void>
+struct is_batch_handler : std::false_type
+{
+};
+
+template <class conn_t, class event_t>
+struct is_batch_handler<conn_t, event_t, std::enable_if_t<!std::is_void<event_t>{}>>
+	: std::conditional_t<has_result_of_type<conn_t, event_t>(),
+			std::false_type,
+			batch_callable<conn_t, event_t>>
+{
+};
+
+/// true if passive_t can be connected directly to an active source sending event_t.
+template <class passive_t, class event_t>
+struct is_passive_sink_for_events
+	: std::integral_constant<bool,
+			is_passive_sink_for<passive_t, event_t>{} || is_batch_handler<passive_t, event_t>{}>
+{
+};
+
 } //namespace detail
 
 } //namespace fc
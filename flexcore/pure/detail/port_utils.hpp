@@ -7,6 +7,8 @@
 #ifndef SRC_PORTS_PORT_UTILS_HPP_
 #define SRC_PORTS_PORT_UTILS_HPP_
 
+#include <flexcore/core/small_function.hpp>
+
 #include <functional>
 #include <algorithm>
 #include <vector>
@@ -99,7 +101,58 @@ public:
 	std::vector<size_t> handler_hashes;
 };
 
+/**
+ * \brief Policy class for multiple handlers, which stores handlers in one contiguous array.
+ *
+ * Small handlers are stored inline in the array instead of on the heap
+ * and the hash of each handler is stored next to it.
+ * Firing an event thus walks a single array instead of
+ * chasing a pointer to the heap for every handler.
+ * Handlers larger than the inline buffer are still allocated on the heap.
+ *
+ * \tparam handler_t std::function type of the handlers, defines their signature.
+ */
+template <class handler_t>
+struct inline_handler_policy;
+
+template <class... args_t>
+struct inline_handler_policy<std::function<void(args_t...)>>
+{
+public:
+	struct entry
+	{
+		template <class handler>
+		entry(handler&& h, size_t hash) : function(std::forward<handler>(h)), hash(hash) {}
+
+		void operator()(args_t... args) { function(std::forward<args_t>(args)...); }
+		explicit operator bool() const noexcept { return static_cast<bool>(function); }
+
+		small_function<void(args_t...)> function;
+		size_t hash;
+	};
+
+	template <class handler>
+	void add_handler(handler&& h, size_t hash)
+	{
+		handlers.emplace_back(std::forward<handler>(h), hash);
+	}
+	void remove_handler(size_t hash)
+	{
+		assert(!handlers.empty());
+
+		auto handler_position = std::find_if(begin(handlers), end(handlers),
+				[hash](const entry& e) { return e.hash == hash; });
+		assert(handler_position != end(handlers));
+		handlers.erase(handler_position);
+	}
+
+	std::vector<entry> handlers;
+};
+
 /** \brief Register callbacks with passive port.
+ *
+ * Handlers are passed on to the storage policy as they are,
+ * which converts them to the type it stores.
  *
  * \tparam handler_t type of handler used by active port.
  * \tparam handler_storage_policy policy class that handles the number of
@@ -133,17 +186,19 @@ public:
 	/** \brief Register a callback with sink, that breaks the connection to source.
 	 * \pre sink_t supports registering callbacks.
 	 */
-	template <class sink_t, std::enable_if_t<fc::has_register_function<sink_t>(0), int> = 0>
-	void add_handler(handler_t handler, sink_t& sink)
+	template <class handler, class sink_t,
+	          std::enable_if_t<fc::has_register_function<sink_t>(0), int> = 0>
+	void add_handler(handler&& h, sink_t& sink)
 	{
-		storage.add_handler(std::move(handler), std::hash<sink_t*>{}(&sink));
+		storage.add_handler(std::forward<handler>(h), std::hash<sink_t*>{}(&sink));
 		sink.register_callback(callback);
 	}
 	/// Do-nothing when sink does not support registering callbacks.
-	template <class sink_t, std::enable_if_t<!fc::has_register_function<sink_t>(0), int> = 0>
-	void add_handler(handler_t handler, sink_t& sink)
+	template <class handler, class sink_t,
+	          std::enable_if_t<!fc::has_register_function<sink_t>(0), int> = 0>
+	void add_handler(handler&& h, sink_t& sink)
 	{
-		storage.add_handler(std::move(handler), std::hash<sink_t*>{}(&sink));
+		storage.add_handler(std::forward<handler>(h), std::hash<sink_t*>{}(&sink));
 	}
 
 	storage_policy<handler_t> storage;
@@ -8,6 +8,7 @@
 #include <flexcore/core/traits.hpp>
 #include <flexcore/pure/detail/port_traits.hpp>
 #include <flexcore/pure/detail/active_connection_proxy.hpp>
+#include <flexcore/pure/event_span.hpp>
 
 namespace fc
 {
@@ -97,6 +98,16 @@ private:
 	std::vector<std::weak_ptr<std::function<void(size_t)>>> connection_breakers;
 };
 
+/**
+ * \brief event_sink, which receives batches of events in a single call.
+ *
+ * Connected to an event_source<event_t>, it receives all events of
+ * event_source::fire_batch at once and single events as batches of one.
+ * \ingroup ports
+ */
+template<class event_t>
+using batch_event_sink = event_sink<event_span<const event_t>>;
+
 } // namespace pure
 } // namespace fc
 
@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -12,11 +13,68 @@
 #include <flexcore/pure/detail/port_utils.hpp>
 #include <flexcore/pure/port_connection.hpp>
 #include <flexcore/pure/detail/active_connection_proxy.hpp>
+#include <flexcore/pure/event_span.hpp>
 
 #include <iostream>
 
 namespace fc
 {
+
+namespace detail
+{
+/**
+ * \brief handlers of an event_source, which receive batches of events.
+ *
+ * Storage is only allocated when the first batch handler is connected,
+ * thus event_sources without batch handlers don't pay for it.
+ */
+template <class event_t, template <class> class handler_storage>
+class batch_handlers
+{
+public:
+	typedef pure::event_span<const event_t> batch_t;
+	typedef typename handle_type<batch_t>::type handler_t;
+
+	template <class conn_t>
+	void connect(conn_t&& c)
+	{
+		if (!port)
+			port = std::make_unique<port_t>();
+		port->add_handler(handler_wrapper(std::forward<conn_t>(c)), get_sink(c));
+	}
+
+	void fire(batch_t events)
+	{
+		if (!port)
+			return;
+		for (auto& target : port->storage.handlers)
+		{
+			assert(target);
+			target(events);
+		}
+	}
+
+	/// sends a single event as a batch of one
+	void fire_single(const event_t& event) { fire(batch_t(&event, 1)); }
+
+	size_t size() const { return port ? port->storage.handlers.size() : 0; }
+
+private:
+	typedef active_port_base<handler_t, handler_storage> port_t;
+	// on the heap, as the callback registered at the sinks points to the port.
+	std::unique_ptr<port_t> port;
+};
+
+/// void events can not be batched.
+template <template <class> class handler_storage>
+class batch_handlers<void, handler_storage>
+{
+public:
+	void fire_single() {}
+	size_t size() const { return 0; }
+};
+} // namespace detail
+
 namespace pure
 {
 
@@ -29,11 +87,19 @@ namespace pure
  * \remark This class is not thread safe with respect to connections
  * i.e. all connections to sinks must be made serially
  *
+ * Sinks can opt into receiving batches of events by expecting event_span<const event_t>,
+ * see fire_batch. Single events are sent to these sinks as batches of one.
+ * Sinks expecting single events receive the events of a batch one by one.
+ *
  * \tparam event_t type of event stored,
  * needs to fulfill copy_constructable or move_constructable.
+ * Move-only events can only be sent to a single sink.
+ * \tparam handler_storage policy storing the connected handlers,
+ * detail::inline_handler_policy stores small handlers inline for cheaper fan-out.
  * \ingroup ports
  */
-template<class event_t>
+template<class event_t,
+         template <class> class handler_storage = detail::multiple_handler_policy>
 struct event_source
 {
 	typedef std::remove_reference_t<event_t> result_t;
@@ -43,6 +109,11 @@ struct event_source
 
 	/**
 	 * \brief Sends parameter as event to all connected conntables and event_sinks.
+	 *
+	 * Batch handlers receive a view of the event first.
+	 * All other handlers but the last receive a copy of the event.
+	 * The last handler receives the event as it was passed to fire,
+	 * thus an rvalue event is moved into it instead of being copied.
 	 * \param event token to be sent through this port.
 	 */
 	template<class... T>
@@ -56,17 +127,54 @@ struct event_source
 		              "tried to call fire with a type, not implicitly convertible to type of port."
 		              "If conversion is required, do the cast before calling fire.");
 
-		for (auto& target : base.storage.handlers)
+		if (batch.size() != 0)
+			batch.fire_single(event...);
+
+		auto& handlers = base.storage.handlers;
+		if (handlers.empty())
+			return;
+
+		const auto last = std::prev(end(handlers));
+		copy_to_handlers(begin(handlers), last, can_copy<T...>{}, event...);
+		assert(*last);
+		(*last)(static_cast<event_t>(std::forward<T>(event))...);
+	}
+
+	/**
+	 * \brief Sends a batch of events to all connected handlers.
+	 *
+	 * Batch handlers receive all events in a single call.
+	 * Handlers of single events receive the events one by one, as if fire was called for each.
+	 * Events of a mutable span are treated as rvalues and moved into the last of these handlers,
+	 * events of a span of const events are copied.
+	 * \param events contiguous events to be sent through this port.
+	 */
+	template<class T>
+	void fire_batch(event_span<T> events)
+	{
+		static_assert(std::is_same<std::remove_const_t<T>, result_t>{},
+				"fire_batch expects a span of events of the type of the port.");
+
+		batch.fire(events);
+
+		auto& handlers = base.storage.handlers;
+		if (handlers.empty())
+			return;
+
+		const auto last = std::prev(end(handlers));
+		for (auto& event : events)
 		{
-			assert(target);
-			target(static_cast<event_t>(event)...);
+			copy_to_handlers(begin(handlers), last, can_copy<T&>{}, event);
+			assert(*last);
+			// moves for mutable spans, copies for spans of const events.
+			(*last)(static_cast<event_t>(std::forward<T>(event)));
 		}
 	}
 
 	/// Gives the number of connections from this port.
 	size_t nr_connected_handlers() const
 	{
-		return base.storage.handlers.size();
+		return base.storage.handlers.size() + batch.size();
 	}
 
 	/**
@@ -81,26 +189,117 @@ struct event_source
 	template <class conn_t>
 	auto connect(conn_t&& c) &
 	{
-		static_assert(detail::has_result_of_type<conn_t, event_t>(),
+		static_assert(detail::has_result_of_type<conn_t, event_t>()
+				|| detail::is_batch_handler<conn_t, result_t>{},
 			"The type returned by this source is not compatible with the connection you "
 			"are trying to establish.");
 
-		base.add_handler(detail::handler_wrapper(std::forward<conn_t>(c)), get_sink(c));
-
-		assert(!base.storage.handlers.empty());
+		connect_impl(std::forward<conn_t>(c), detail::is_batch_handler<conn_t, result_t>{});
 		return port_connection<decltype(this), conn_t, result_t>();
 	}
 
 private:
+	template <class conn_t>
+	void connect_impl(conn_t&& c, std::false_type /*batch handler*/)
+	{
+		assert((events_copyable() || base.storage.handlers.empty())
+				&& "events which can not be copied can only be sent to a single sink.");
+		base.add_handler(detail::handler_wrapper(std::forward<conn_t>(c)), get_sink(c));
+		assert(!base.storage.handlers.empty());
+	}
+
+	template <class conn_t>
+	void connect_impl(conn_t&& c, std::true_type /*batch handler*/)
+	{
+		batch.connect(std::forward<conn_t>(c));
+	}
+
+	static constexpr bool events_copyable()
+	{
+		return std::is_void<event_t>{} || std::is_copy_constructible<result_t>{};
+	}
+
+	/// true if event_t can be constructed from lvalues of T, always true for void events.
+	template <class... T>
+	using can_copy = std::integral_constant<bool, sizeof...(T) == 0
+			|| std::is_constructible<event_t, std::add_lvalue_reference_t<T>...>{}>;
+
+	template <class iter_t, class... T>
+	void copy_to_handlers(iter_t first, iter_t last, std::true_type, T&... event)
+	{
+		for (; first != last; ++first)
+		{
+			assert(*first);
+			(*first)(static_cast<event_t>(event)...);
+		}
+	}
+
+	/// move-only events have only a single handler, see connect.
+	template <class iter_t, class... T>
+	void copy_to_handlers(iter_t first, iter_t last, std::false_type, T&...)
+	{
+		assert(first == last);
+		(void)first;
+		(void)last;
+	}
+
 	// Stores event_handlers in a vector, the node needs to send
 	// to all connected event_handlers when an event is fired.
-	detail::active_port_base<handler_t, detail::multiple_handler_policy> base;
+	detail::active_port_base<handler_t, handler_storage> base;
+	detail::batch_handlers<result_t, handler_storage> batch;
+};
+
+/**
+ * \brief event_source which stores its handlers in one contiguous array.
+ *
+ * Prefer this over event_source for sources with many sinks and high event rates.
+ */
+template<class event_t>
+using inline_event_source = event_source<event_t, detail::inline_handler_policy>;
+
+/**
+ * \brief event_source, which shares a single immutable copy of each event with all sinks.
+ *
+ * Every event is wrapped once in a std::shared_ptr<const data_t>
+ * and all sinks receive a copy of this pointer instead of a copy of the event.
+ * Thus sending to many sinks costs a reference count per sink independent of
+ * the size of the event, which pays off for large events like std::vector.
+ * Sinks need to expect std::shared_ptr<const data_t> and can not modify the event.
+ *
+ * \tparam data_t type of the shared event, needs to be move_constructable.
+ * \ingroup ports
+ */
+template<class data_t,
+         template <class> class handler_storage = detail::multiple_handler_policy>
+struct broadcast_event_source
+		: event_source<std::shared_ptr<const data_t>, handler_storage>
+{
+	typedef std::shared_ptr<const data_t> payload_t;
+
+	/// Wraps event in a shared buffer and sends it to all sinks.
+	void fire(data_t event)
+	{
+		base_t::fire(std::make_shared<const data_t>(std::move(event)));
+	}
+
+	/// Sends an event, which is already shared, to all sinks.
+	void fire(payload_t event)
+	{
+		assert(event);
+		base_t::fire(std::move(event));
+	}
+
+private:
+	typedef event_source<payload_t, handler_storage> base_t;
 };
 
 } // namespace pure
 
 // traits
-template<class T> struct is_active_source<pure::event_source<T>> : std::true_type {};
+template<class T, template <class> class storage>
+struct is_active_source<pure::event_source<T, storage>> : std::true_type {};
+template<class T, template <class> class storage>
+struct is_active_source<pure::broadcast_event_source<T, storage>> : std::true_type {};
 
 } // namespace fc
 
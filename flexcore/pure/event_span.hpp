@@ -0,0 +1,79 @@
+#ifndef SRC_PORTS_EVENT_SPAN_HPP_
+#define SRC_PORTS_EVENT_SPAN_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace fc
+{
+namespace pure
+{
+
+/**
+ * \brief non owning view of a contiguous sequence of events.
+ *
+ * Used to send a batch of events through a single handler call,
+ * see event_source::fire_batch.
+ * The events need to outlive the event_span.
+ *
+ * \tparam T type of events, const if the events are read only.
+ */
+template<class T>
+class event_span
+{
+public:
+	typedef T value_type;
+	typedef T* iterator;
+
+	event_span() noexcept = default;
+	event_span(T* first_event, size_t size) noexcept
+		: first(first_event), nr_of_events(size)
+	{
+		assert(first_event != nullptr || size == 0);
+	}
+
+	/// views all events in vector, except for std::vector<bool>, which is not contiguous.
+	template <class alloc_t, class U = T,
+	          class = std::enable_if_t<!std::is_same<std::remove_const_t<U>, bool>{}>>
+	event_span(std::vector<std::remove_const_t<T>, alloc_t>& events) noexcept
+		: event_span(events.data(), events.size())
+	{
+	}
+
+	/// views all events in a const vector, only possible for read only spans.
+	template <class alloc_t, class U = T, class = std::enable_if_t<std::is_const<U>{}
+	          && !std::is_same<std::remove_const_t<U>, bool>{}>>
+	event_span(const std::vector<std::remove_const_t<T>, alloc_t>& events) noexcept
+		: event_span(events.data(), events.size())
+	{
+	}
+
+	/// mutable spans are convertible to read only spans.
+	template <class U, class = std::enable_if_t<std::is_same<const U, T>{}>>
+	event_span(const event_span<U>& other) noexcept
+		: event_span(other.begin(), other.size())
+	{
+	}
+
+	iterator begin() const noexcept { return first; }
+	iterator end() const noexcept { return first + nr_of_events; }
+	size_t size() const noexcept { return nr_of_events; }
+	bool empty() const noexcept { return nr_of_events == 0; }
+
+	T& operator[](size_t i) const
+	{
+		assert(i < nr_of_events);
+		return first[i];
+	}
+
+private:
+	T* first = nullptr;
+	size_t nr_of_events = 0;
+};
+
+} // namespace pure
+} // namespace fc
+
+#endif /* SRC_PORTS_EVENT_SPAN_HPP_ */
@@ -5,6 +5,7 @@
 #include <flexcore/pure/event_sinks.hpp>
 #include <flexcore/pure/state_sink.hpp>
 #include <flexcore/pure/state_sources.hpp>
+#include <flexcore/pure/static_event_source.hpp>
 
 /**
 * \defgroup ports
@@ -0,0 +1,125 @@
+#ifndef SRC_PORTS_EVENT_SOURCES_STATIC_EVENT_SOURCE_HPP_
+#define SRC_PORTS_EVENT_SOURCES_STATIC_EVENT_SOURCE_HPP_
+
+#include <tuple>
+#include <utility>
+
+#include <flexcore/core/traits.hpp>
+#include <flexcore/core/connection.hpp>
+#include <flexcore/pure/detail/port_utils.hpp>
+
+namespace fc
+{
+namespace pure
+{
+
+/**
+ * \brief Output port for events with a set of connections fixed at compile time.
+ *
+ * In contrast to event_source, the connections are not type erased,
+ * but stored with their concrete types in a tuple.
+ * Thus the compiler can inline the whole chain of connectables into fire.
+ * Connecting returns a new static_event_source with the additional connection,
+ * the complete graph is built up front:
+ * \code{cpp}
+ * auto source = static_event_source<int>{}
+ *         .connect([](int i){ return i + 1; } >> sink_a)
+ *         .connect(sink_b);
+ * source.fire(1);
+ * \endcode
+ *
+ * Connections can not be removed.
+ * Sinks connected by reference need to outlive the static_event_source.
+ *
+ * \tparam event_t type of event sent, see event_source.
+ * \tparam handler_t types of the connected handlers.
+ * \ingroup ports
+ */
+template<class event_t, class... handler_t>
+class static_event_source
+{
+public:
+	typedef std::remove_reference_t<event_t> result_t;
+
+	static_event_source() = default;
+	explicit static_event_source(std::tuple<handler_t...> connected)
+		: handlers(std::move(connected))
+	{
+	}
+
+	/**
+	 * \brief Sends parameter as event to all connected handlers.
+	 *
+	 * As event_source::fire, all handlers but the last receive a copy of the event
+	 * and the event is forwarded to the last handler.
+	 * \param event token to be sent through this port.
+	 */
+	template<class... T>
+	void fire(T&&... event)
+	{
+		static_assert(sizeof...(T) == 0 || sizeof...(T) == 1,
+				"we only allow single events, or void events atm");
+
+		static_assert(std::is_void<event_t>{} ||
+		              std::is_constructible<event_t, T...>{},
+		              "tried to call fire with a type, not implicitly convertible to type of port."
+		              "If conversion is required, do the cast before calling fire.");
+
+		copy_to_handlers(std::make_index_sequence<nr_of_copies>{}, event...);
+		forward_to_last(std::integral_constant<bool, (nr_of_handlers > 0)>{},
+				std::forward<T>(event)...);
+	}
+
+	/// Gives the number of connections from this port.
+	static constexpr size_t nr_connected_handlers() { return nr_of_handlers; }
+
+	/**
+	 * \brief returns a static_event_source with all connections of this one and c.
+	 *
+	 * Lvalues are connected by reference, rvalues are moved into the new port.
+	 * \param c the new target to be connected.
+	 */
+	template <class conn_t>
+	auto connect(conn_t&& c) &&
+	{
+		static_assert(detail::has_result_of_type<conn_t, event_t>(),
+			"The type returned by this source is not compatible with the connection you "
+			"are trying to establish.");
+
+		typedef std::decay_t<decltype(detail::handler_wrapper(std::forward<conn_t>(c)))>
+				new_handler_t;
+		return static_event_source<event_t, handler_t..., new_handler_t>(std::tuple_cat(
+				std::move(handlers),
+				std::tuple<new_handler_t>(detail::handler_wrapper(std::forward<conn_t>(c)))));
+	}
+
+private:
+	static constexpr size_t nr_of_handlers = sizeof...(handler_t);
+	static constexpr size_t nr_of_copies = nr_of_handlers == 0 ? 0 : nr_of_handlers - 1;
+
+	template <size_t... index, class... T>
+	void copy_to_handlers(std::index_sequence<index...>, T&... event)
+	{
+		// call handlers in order of connection.
+		using expand = int[];
+		(void)expand{0, (void(std::get<index>(handlers)(static_cast<event_t>(event)...)), 0)...};
+	}
+
+	template <class... T>
+	void forward_to_last(std::true_type, T&&... event)
+	{
+		std::get<nr_of_handlers - 1>(handlers)(static_cast<event_t>(std::forward<T>(event))...);
+	}
+
+	template <class... T>
+	void forward_to_last(std::false_type, T&&...)
+	{
+	}
+
+	std::tuple<handler_t...> handlers;
+};
+
+} // namespace pure
+} // namespace fc
+
+#endif /* SRC_PORTS_EVENT_SOURCES_STATIC_EVENT_SOURCE_HPP_ */
@@ -12,19 +12,13 @@ namespace fc
 
 namespace chr = std::chrono;
 
-std::atomic<virtual_clock::system::time_point>
-		virtual_clock::system::current_time((
-				virtual_clock::system::time_point(
-						virtual_clock::system::duration::zero())));
-std::atomic<virtual_clock::steady::time_point>
-		virtual_clock::steady::current_time((
-				virtual_clock::steady::time_point(
-						virtual_clock::steady::duration::zero())));
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+		"virtual clock requires lock-free 64 bit atomics");
+static_assert(sizeof(long long) >= sizeof(virtual_clock::rep),
+		"time_storage needs to be able to hold all values of virtual_clock::rep");
 
-virtual_clock::system::time_point virtual_clock::system::now() noexcept
-{
-	return current_time.load();
-}
+virtual_clock::domain virtual_clock::domain::global_domain;
+thread_local virtual_clock::domain* virtual_clock::domain::current_domain = nullptr;
 
 std::time_t virtual_clock::system::to_time_t(const time_point& t)
 {
@@ -43,24 +37,17 @@ virtual_clock::system::time_point virtual_clock::system::from_time_t(std::time_t
 
 void virtual_clock::system::advance(duration d) noexcept
 {
-	const auto tmp = current_time.load();
-	current_time.store(tmp + d);
+	domain::current().system_time.fetch_add(d.count(), std::memory_order_acq_rel);
 }
 
 void virtual_clock::system::set_time(time_point r) noexcept
 {
-	current_time.store(r);
-}
-
-virtual_clock::steady::time_point virtual_clock::steady::now() noexcept
-{
-	return current_time.load();
+	domain::current().system_time.store(r.time_since_epoch().count(), std::memory_order_release);
 }
 
 void virtual_clock::steady::advance(duration d) noexcept
 {
-	const auto tmp = current_time.load();
-	current_time.store(tmp + d);
+	domain::current().steady_time.fetch_add(d.count(), std::memory_order_acq_rel);
 }
 
 }  //namespace fc
@@ -51,6 +51,61 @@ struct virtual_clock
 	typedef duration::rep rep; ///<storage format of the time
 	typedef duration::period period; ///<duration of a tick == smallest duration possible
 
+	/**
+	 * \brief storage of the current time as count of ticks since the epoch.
+	 *
+	 * A plain 64 bit integer instead of a time_point,
+	 * thus reading and advancing the clock are single lock-free atomic operations.
+	 */
+	typedef std::atomic<long long> time_storage;
+
+	class system;
+	struct steady;
+
+	/**
+	 * \brief Independent time of the virtual clocks.
+	 *
+	 * virtual_clock::system and virtual_clock::steady read and advance
+	 * the domain which is current for the calling thread.
+	 * Threads use the global domain, unless another domain is made current with a scope.
+	 * cycle_control makes its domain current for its main loop and all its tasks,
+	 * thus several cycle_controls can run side by side with independent time.
+	 */
+	class domain
+	{
+	public:
+		domain() = default;
+		domain(const domain&) = delete;
+		domain& operator=(const domain&) = delete;
+
+		/// domain of the calling thread
+		static domain& current() noexcept;
+		/// process wide domain, current for all threads without scope.
+		static domain& global() noexcept { return global_domain; }
+
+		/// makes a domain current for the calling thread for the lifetime of the scope.
+		class scope
+		{
+		public:
+			explicit scope(domain& d) noexcept : previous(current_domain) { current_domain = &d; }
+			~scope() { current_domain = previous; }
+			scope(const scope&) = delete;
+			scope& operator=(const scope&) = delete;
+		private:
+			domain* previous;
+		};
+
+	private:
+		friend class virtual_clock::system;
+		friend struct virtual_clock::steady;
+		time_storage system_time{0};
+		time_storage steady_time{0};
+
+		static domain global_domain;
+		/// current domain of the thread, nullptr selects the global domain.
+		static thread_local domain* current_domain;
+	};
+
 	/**
 	 * \brief virtual clock for measuring time points in simulation time
 	 *
@@ -79,8 +134,6 @@ struct virtual_clock
 
 		static void advance(duration d) noexcept;
 		static void set_time(time_point r) noexcept;
-
-		static std::atomic<time_point> current_time;
 	};
 
 	/**
@@ -109,11 +162,24 @@ struct virtual_clock
 		friend class master_clock;
 
 		static void advance(duration d) noexcept;
-
-		static std::atomic<time_point> current_time;
 	};
 };
 
+inline virtual_clock::domain& virtual_clock::domain::current() noexcept
+{
+	return current_domain ? *current_domain : global_domain;
+}
+
+inline virtual_clock::system::time_point virtual_clock::system::now() noexcept
+{
+	return time_point(duration(domain::current().system_time.load(std::memory_order_acquire)));
+}
+
+inline virtual_clock::steady::time_point virtual_clock::steady::now() noexcept
+{
+	return time_point(duration(domain::current().steady_time.load(std::memory_order_acquire)));
+}
+
 /**
  * \brief controls the time of the two virtual clocks.
  *
@@ -142,6 +208,19 @@ public:
 				std::chrono::duration_cast<virtual_clock::system::duration>
 				(duration(1)));
 	}
+	/**
+	 * \brief advances clock by the duration d
+	 *
+	 * Allows to advance the clock with a step size only known at runtime.
+	 * \pre d >= duration::zero()
+	 */
+	static void advance(duration d) noexcept
+	{
+		steady_clock.advance(
+				std::chrono::duration_cast<virtual_clock::steady::duration>(d));
+		system_clock.advance(
+				std::chrono::duration_cast<virtual_clock::system::duration>(d));
+	}
 	static void set_time(virtual_clock::system::time_point r) noexcept
 	{
 		system_clock.set_time(r);
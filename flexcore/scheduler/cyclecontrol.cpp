@@ -2,20 +2,104 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <cassert>
+#include <map>
+#include <numeric>
 
 namespace fc
 {
 namespace thread
 {
 
-using clock = master_clock<std::centi>;
+using clock = master_clock<virtual_clock::period>;
+
+namespace
+{
+/// greatest common divisor, std::gcd is only available from C++17 on.
+uint64_t gcd(uint64_t a, uint64_t b)
+{
+	while (b != 0)
+	{
+		const auto rest = a % b;
+		a = b;
+		b = rest;
+	}
+	return a;
+}
+
+/// ordering of entries in the due_queue of cycle_control, makes it a min-heap of the due tick.
+const auto later = [](const auto& lhs, const auto& rhs)
+{
+	return lhs.due_tick > rhs.due_tick;
+};
+
+/**
+ * \brief assigns every region to a wave, such that it comes after all regions it depends on.
+ *
+ * Uses Kahn's algorithm, the wave of a region is the length of the longest path leading to it.
+ * Regions which are part of or depend on a cycle are put into an additional final wave.
+ * Dependencies on regions not in waves are ignored.
+ * \param waves contains all regions as keys, the values are set to the wave of the region.
+ * \returns number of waves
+ */
+size_t assign_waves(std::map<const parallel_region*, size_t>& waves,
+                    const std::vector<region_dependency>& dependencies)
+{
+	std::map<const parallel_region*, size_t> nr_of_producers;
+	std::multimap<const parallel_region*, const parallel_region*> consumers;
+	for (const auto& d : dependencies)
+	{
+		if (waves.count(d.producer) == 0 || waves.count(d.consumer) == 0)
+			continue;
+		++nr_of_producers[d.consumer];
+		consumers.emplace(d.producer, d.consumer);
+	}
+
+	std::vector<const parallel_region*> ready;
+	for (auto& w : waves)
+	{
+		w.second = 0;
+		if (nr_of_producers[w.first] == 0)
+			ready.push_back(w.first);
+	}
+
+	size_t nr_of_waves = waves.empty() ? 0 : 1;
+	size_t nr_of_sorted = 0;
+	while (!ready.empty())
+	{
+		const auto producer = ready.back();
+		ready.pop_back();
+		++nr_of_sorted;
+		const auto range = consumers.equal_range(producer);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			waves[it->second] = std::max(waves[it->second], waves[producer] + 1);
+			nr_of_waves = std::max(nr_of_waves, waves[it->second] + 1);
+			if (--nr_of_producers[it->second] == 0)
+				ready.push_back(it->second);
+		}
+	}
+
+	if (nr_of_sorted != waves.size())
+	{
+		// regions in cycles never became ready
+		for (auto& w : waves)
+			if (nr_of_producers[w.first] != 0)
+				w.second = nr_of_waves;
+		++nr_of_waves;
+	}
+	return nr_of_waves;
+}
+}
 constexpr wall_clock::steady::duration cycle_control::min_tick_length;
 constexpr virtual_clock::steady::duration cycle_control::fast_tick;
 constexpr virtual_clock::steady::duration cycle_control::medium_tick;
 constexpr virtual_clock::steady::duration cycle_control::slow_tick;
+constexpr uint64_t cycle_control::max_hyperperiod;
 
-cycle_control::cycle_control(std::unique_ptr<scheduler> scheduler)
-    : cycle_control(std::move(scheduler), [this](auto& task)
+cycle_control::cycle_control(std::unique_ptr<scheduler> scheduler,
+                             wall_clock::steady::duration tick_length)
+    : cycle_control(std::move(scheduler), tick_length, [this](auto& task)
                     {
 	                    return store_exception(task);
                     })
@@ -24,13 +108,22 @@ cycle_control::cycle_control(std::unique_ptr<scheduler> scheduler)
 
 void cycle_control::start(bool fast)
 {
+	build_schedule();
 	keep_working.store(true);
 	running = true;
 	// give the main thread some actual work to do (execute infinite main loop)
 	if (fast)
-		main_loop_thread = std::thread{[this] { fast_main_loop(); }};
+		main_loop_thread = std::thread{[this]
+		{
+			virtual_clock::domain::scope clock_scope{*clock_domain_};
+			fast_main_loop();
+		}};
 	else
-		main_loop_thread = std::thread{[this] { normal_main_loop(); }};
+		main_loop_thread = std::thread{[this]
+		{
+			virtual_clock::domain::scope clock_scope{*clock_domain_};
+			normal_main_loop();
+		}};
 }
 
 void cycle_control::stop()
@@ -39,15 +132,24 @@ void cycle_control::stop()
 	if (main_loop_thread.joinable())
 		main_loop_thread.join();
 	// wait for scheduled tasks to finish
-	auto wait_or_throw = [](auto& task_vector)
+	for (auto& bucket : buckets)
 	{
-		for (auto& t : task_vector)
-			if (!t.wait_until_done(slow_tick))
+		const auto timeout = std::max<virtual_clock::duration>(slow_tick, bucket.tick_rate);
+		for (auto& t : bucket.tasks)
+			if (!t.wait_until_done(timeout))
 				throw out_of_time_exception{};
-	};
-	wait_or_throw(tasks_fast);
-	wait_or_throw(tasks_medium);
-	wait_or_throw(tasks_slow);
+	}
+	// executions delayed by overrun_policy::queue_one are dropped.
+	for (auto& queued : queued_tasks)
+		buckets[queued.bucket].tasks[queued.task].queued = false;
+	queued_tasks.clear();
+	// as are executions waiting for their producers.
+	for (auto& bucket : buckets)
+	{
+		for (auto& task : bucket.tasks)
+			task.pending = false;
+		bucket.nr_of_pending = 0;
+	}
 	running = false;
 }
 
@@ -59,44 +161,433 @@ bool cycle_control::store_exception(periodic_task&)
 	return false;
 }
 
+uint64_t cycle_control::current_tick() const
+{
+	return virtual_clock::steady::now().time_since_epoch() / tick_length_;
+}
+
+void cycle_control::build_schedule()
+{
+	hyperperiod = 1;
+	for (const auto& bucket : buckets)
+	{
+		hyperperiod = hyperperiod / gcd(hyperperiod, bucket.rate_in_ticks) * bucket.rate_in_ticks;
+		if (hyperperiod > max_hyperperiod)
+			break;
+	}
+	schedule_offsets.clear();
+	schedule_buckets.clear();
+	if (hyperperiod > max_hyperperiod)
+	{
+		hyperperiod = 0;
+		schedule_outdated = false;
+		return;
+	}
+
+	// run slow tasks first, as they have the most time to complete.
+	std::vector<size_t> slow_first(buckets.size());
+	std::iota(begin(slow_first), end(slow_first), 0);
+	std::sort(begin(slow_first), end(slow_first), [this](size_t lhs, size_t rhs)
+			{
+				return buckets[lhs].rate_in_ticks > buckets[rhs].rate_in_ticks;
+			});
+	schedule_offsets.reserve(hyperperiod + 1);
+	for (uint64_t tick = 0; tick != hyperperiod; ++tick)
+	{
+		schedule_offsets.push_back(schedule_buckets.size());
+		for (auto bucket : slow_first)
+			if (tick % buckets[bucket].rate_in_ticks == 0)
+				schedule_buckets.push_back(bucket);
+	}
+	schedule_offsets.push_back(schedule_buckets.size());
+	schedule_outdated = false;
+}
+
+void cycle_control::take_due(uint64_t tick)
+{
+	if (schedule_outdated)
+		build_schedule();
+	taken_entries.clear();
+	due_now.clear();
+	if (hyperperiod != 0)
+	{
+		const auto slot = tick % hyperperiod;
+		due_now.assign(begin(schedule_buckets) + schedule_offsets[slot],
+		               begin(schedule_buckets) + schedule_offsets[slot + 1]);
+		return;
+	}
+
+	while (!due_queue.empty() && due_queue.front().due_tick <= tick)
+	{
+		std::pop_heap(begin(due_queue), end(due_queue), later);
+		auto entry = due_queue.back();
+		due_queue.pop_back();
+
+		const auto rate = buckets[entry.bucket].rate_in_ticks;
+		// bucket has missed ticks (clock was advanced elsewhere), move to next multiple of rate.
+		if (entry.due_tick < tick)
+			entry.due_tick = (tick + rate - 1) / rate * rate;
+		if (entry.due_tick == tick)
+			due_now.push_back(entry.bucket);
+		taken_entries.push_back(entry);
+	}
+	// run slow tasks first, as they have the most time to complete.
+	std::sort(begin(due_now), end(due_now), [this](size_t lhs, size_t rhs)
+			{
+				return buckets[lhs].rate_in_ticks > buckets[rhs].rate_in_ticks;
+			});
+}
+
+void cycle_control::reschedule_due(uint64_t tick, bool advance)
+{
+	for (auto entry : taken_entries)
+	{
+		if (advance && entry.due_tick == tick)
+			entry.due_tick += buckets[entry.bucket].rate_in_ticks;
+		due_queue.push_back(entry);
+		std::push_heap(begin(due_queue), end(due_queue), later);
+	}
+	taken_entries.clear();
+}
+
 void cycle_control::work()
 {
-	auto now = virtual_clock::steady::now().time_since_epoch();
-	auto run_if_due = [this, now](auto tick_rate, auto& task_vector)
+	virtual_clock::domain::scope clock_scope{*clock_domain_};
+	const auto tick = current_tick();
+	clock::advance(std::chrono::duration_cast<clock::duration>(tick_length_));
+	run_tick(tick);
+}
+
+void cycle_control::replay_tick(virtual_clock::system::time_point timestamp)
+{
+	if (running)
+		throw std::runtime_error{"Replay is not possible while main loop is running"};
+
+	virtual_clock::domain::scope clock_scope{*clock_domain_};
+	const auto tick = current_tick();
+	clock::advance(std::chrono::duration_cast<clock::duration>(tick_length_));
+	clock::set_time(timestamp);
+	run_tick(tick);
+	wait_for_all_tasks();
+}
+
+void cycle_control::wait_for_all_tasks()
+{
+	bool pending = false;
+	do
 	{
-		if (now % tick_rate == virtual_clock::duration::zero())
-			if (!run_periodic_tasks(task_vector))
-				return false;
+		for (auto& bucket : buckets)
+			while (!bucket.latch->wait_for(bucket.tick_rate))
+			{
+				// replays don't run in realtime, keep waiting.
+			}
+		// consumers of slower buckets are still waiting for their producers.
+		pending = std::any_of(begin(buckets), end(buckets),
+				[](const task_bucket& bucket) { return bucket.nr_of_pending != 0; });
+	} while (pending && dispatch_waves());
+}
+
+void cycle_control::run_tick(uint64_t tick)
+{
+	take_due(tick);
+	if (dependency_ordered)
+	{
+		run_waves();
+	}
+	else
+	{
+		for (auto bucket : due_now)
+			if (!run_periodic_tasks(buckets[bucket]))
+				break;
+	}
+	run_queued_tasks();
+	reschedule_due(tick, true);
+}
+
+bool cycle_control::handle_overrun(periodic_task& task, task_bucket& bucket)
+{
+	task.statistics().record_overrun();
+	switch (task.policy)
+	{
+	case overrun_policy::skip_tick:
+		task.statistics().record_skipped_tick();
+		return true;
+	case overrun_policy::queue_one:
+		if (task.queued)
+		{
+			task.statistics().record_skipped_tick();
+		}
+		else
+		{
+			task.statistics().record_queued_tick();
+			task.queued = true;
+			queued_tasks.push_back(queued_task{size_t(&bucket - buckets.data()),
+			                                   size_t(&task - bucket.tasks.data())});
+		}
+		return true;
+	case overrun_policy::abort:
+		break;
+	}
+	if (error_callback(task))
 		return true;
-	};
-	clock::advance();
-	if (!run_if_due(slow_tick, tasks_slow)) return;
-	if (!run_if_due(medium_tick, tasks_medium)) return;
-	if (!run_if_due(fast_tick, tasks_fast)) return;
+	keep_working.store(false);
+	return false;
 }
 
-void cycle_control::wait_for_current_tasks()
+void cycle_control::run_queued_tasks()
+{
+	if (queued_tasks.empty())
+		return;
+
+	const auto dispatch_time = wall_clock::steady::now();
+	auto still_queued = std::remove_if(begin(queued_tasks), end(queued_tasks),
+			[this, dispatch_time](const queued_task& queued)
+			{
+				auto& bucket = buckets[queued.bucket];
+				auto& task = bucket.tasks[queued.task];
+				// tasks which have been due in the meantime have already been dispatched.
+				if (!task.queued)
+					return true;
+				if (!task.done() || (dependency_ordered && !task.producers_ready()))
+					return false;
+				add_to_batch(task, bucket, dispatch_time,
+						!dependency_ordered || task.unordered_producers_done());
+				return true;
+			});
+	queued_tasks.erase(still_queued, end(queued_tasks));
+	dispatch_batch();
+}
+
+void cycle_control::add_to_batch(periodic_task& task, task_bucket& bucket,
+		wall_clock::steady::time_point dispatch_time, bool switch_inputs)
+{
+	task.queued = false;
+	task.set_work_to_do(true);
+	bucket.latch->add(1);
+	if (dependency_ordered)
+	{
+		if (switch_inputs)
+			task.send_input_switch_tick();
+		batch.emplace_back([&task, latch = bucket.latch.get(), domain = clock_domain_.get()]
+		{
+			virtual_clock::domain::scope clock_scope{*domain};
+			task.run_and_switch_outputs();
+			latch->count_down();
+		});
+	}
+	else
+	{
+		task.send_switch_tick();
+		task.outputs_pending = true;
+		batch.emplace_back([&task, latch = bucket.latch.get(), domain = clock_domain_.get()]
+		{
+			virtual_clock::domain::scope clock_scope{*domain};
+			task();
+			latch->count_down();
+		});
+	}
+	task.statistics().record_dispatch(dispatch_time);
+	scheduler::task_hints hints;
+	// every task has to be finished, before it is due again.
+	hints.deadline = dispatch_time
+			+ std::chrono::duration_cast<wall_clock::steady::duration>(bucket.tick_rate);
+	hints.affinity = task.get_worker_affinity();
+	batch_hints.push_back(hints);
+}
+
+void cycle_control::dispatch_batch()
+{
+	if (batch.empty())
+		return;
+	scheduler_->add_tasks_with_hints(batch, batch_hints);
+	batch.clear();
+	batch_hints.clear();
+}
+
+bool cycle_control::run_waves()
+{
+	if (waves_outdated)
+		update_waves();
+
+	for (auto bucket_index : due_now)
+	{
+		auto& bucket = buckets[bucket_index];
+		for (auto& task : bucket.tasks)
+		{
+			// the task has waited for its producers during its whole last period.
+			if (task.pending)
+			{
+				task.statistics().record_skipped_tick();
+				task.pending = false;
+				--bucket.nr_of_pending;
+			}
+			if (!task.done() && !handle_overrun(task, bucket))
+				return false;
+			// tasks still running after an overrun have been handled above.
+			if (task.done())
+			{
+				task.pending = true;
+				++bucket.nr_of_pending;
+			}
+		}
+	}
+	return dispatch_waves();
+}
+
+bool cycle_control::dispatch_waves()
 {
-	auto now = virtual_clock::steady::now().time_since_epoch();
-	auto wait_for_tasks = [this, now](auto tick_rate, auto& task_vector)
+	for (size_t wave = 0; wave != nr_of_waves; ++wave)
 	{
-		if (now % tick_rate == virtual_clock::duration::zero())
+		wave_tasks.clear();
+		const auto dispatch_time = wall_clock::steady::now();
+		for (auto& bucket : buckets)
+		{
+			if (bucket.nr_of_pending == 0)
+				continue;
+			for (auto task_index : bucket.waves[wave])
+			{
+				auto& task = bucket.tasks[task_index];
+				if (!task.pending || !task.producers_ready())
+					continue;
+				task.pending = false;
+				--bucket.nr_of_pending;
+				const bool switch_inputs = task.unordered_producers_done();
+				// the activation is kept, until the inputs can be switched.
+				if (!switch_inputs && task.event_driven())
+					continue;
+				if (task.take_activation())
+					wave_tasks.push_back(running_task{&task, &bucket, switch_inputs});
+			}
+		}
+		// dispatched only after all checks, as regions in a cycle share the final wave.
+		for (auto& running : wave_tasks)
+			add_to_batch(*running.task, *running.bucket, dispatch_time, running.switch_inputs);
+		dispatch_batch();
+		// the next wave may only start, once all producers have switched their outputs.
+		// Waiting for slower buckets would delay the next tick, their consumers
+		// are dispatched in a later tick instead.
+		for (auto& running : wave_tasks)
 		{
-			for (auto& task : task_vector)
-				if (!task.wait_until_done(tick_rate))
+			if (running.bucket->rate_in_ticks != 1 || !running.task->consumers_pending())
+				continue;
+			while (!running.task->wait_until_done(running.bucket->tick_rate))
+			{
+				// tasks with a graceful policy are handled once they are due again,
+				// their consumers wait until they are done.
+				if (running.task->policy != overrun_policy::abort)
+					break;
+				running.task->statistics().record_overrun();
+				if (!error_callback(*running.task))
 				{
-					if (!error_callback(task))
-					{
-						keep_working.store(false);
-						return false;
-					}
+					keep_working.store(false);
+					return false;
 				}
+			}
 		}
-		return true;
-	};
-	if (!wait_for_tasks(slow_tick, tasks_slow)) return;
-	if (!wait_for_tasks(medium_tick, tasks_medium)) return;
-	if (!wait_for_tasks(fast_tick, tasks_fast)) return;
+	}
+	return true;
+}
+
+void cycle_control::update_waves()
+{
+	std::map<const parallel_region*, size_t> region_waves;
+	std::map<const parallel_region*, std::pair<periodic_task*, uint64_t>> region_tasks;
+	for (auto& bucket : buckets)
+		for (auto& task : bucket.tasks)
+		{
+			task.producers.clear();
+			task.consumers.clear();
+			task.unordered_producers.clear();
+			if (task.get_region())
+			{
+				region_waves.emplace(task.get_region(), 0);
+				region_tasks.emplace(task.get_region(), std::make_pair(&task, bucket.rate_in_ticks));
+			}
+		}
+
+	// only producers in the same or a faster bucket are waited for.
+	std::vector<region_dependency> ordered;
+	std::vector<region_dependency> unordered;
+	for (const auto& d : region_dependencies)
+	{
+		const auto producer = region_tasks.find(d.producer);
+		const auto consumer = region_tasks.find(d.consumer);
+		if (producer == end(region_tasks) || consumer == end(region_tasks)
+		    || producer == consumer)
+			continue;
+		if (producer->second.second <= consumer->second.second)
+			ordered.push_back(d);
+		else
+			unordered.push_back(d);
+	}
+	nr_of_waves = std::max<size_t>(1, assign_waves(region_waves, ordered));
+
+	for (const auto& d : ordered)
+	{
+		const auto producer = region_tasks[d.producer].first;
+		const auto consumer = region_tasks[d.consumer].first;
+		// connections within the final wave keep the delay of one tick.
+		if (region_waves[d.producer] < region_waves[d.consumer])
+		{
+			consumer->producers.push_back(producer);
+			producer->consumers.push_back(consumer);
+		}
+		else
+		{
+			unordered.push_back(d);
+		}
+	}
+	for (const auto& d : unordered)
+		region_tasks[d.consumer].first->unordered_producers.push_back(region_tasks[d.producer].first);
+
+	for (auto& bucket : buckets)
+	{
+		bucket.waves.assign(nr_of_waves, {});
+		for (size_t i = 0; i != bucket.tasks.size(); ++i)
+		{
+			// tasks without region have no dependencies and run in the first wave.
+			const auto region = bucket.tasks[i].get_region();
+			bucket.waves[region ? region_waves[region] : 0].push_back(i);
+		}
+	}
+	waves_outdated = false;
+}
+
+void cycle_control::set_region_dependencies(std::vector<region_dependency> dependencies)
+{
+	if (running)
+		throw std::runtime_error{"Worker threads are already running"};
+	region_dependencies = std::move(dependencies);
+	dependency_ordered = true;
+	waves_outdated = true;
+}
+
+void cycle_control::wait_for_current_tasks()
+{
+	const auto tick = current_tick();
+	take_due(tick);
+	for (auto bucket : due_now)
+		if (!buckets[bucket].latch->wait_for(buckets[bucket].tick_rate)
+		    && !handle_late_tasks(buckets[bucket]))
+			break;
+	reschedule_due(tick, false);
+}
+
+bool cycle_control::handle_late_tasks(task_bucket& bucket)
+{
+	for (auto& task : bucket.tasks)
+	{
+		// tasks with a graceful policy are handled once they are due again.
+		if (task.done() || task.policy != overrun_policy::abort)
+			continue;
+		task.statistics().record_overrun();
+		if (!error_callback(task))
+		{
+			keep_working.store(false);
+			return false;
+		}
+	}
+	return true;
 }
 
 void cycle_control::fast_main_loop()
@@ -110,12 +601,66 @@ void cycle_control::fast_main_loop()
 
 void cycle_control::normal_main_loop()
 {
+	auto deadline = wall_clock::steady::now();
 	while (keep_working.load())
 	{
-		const auto now = wall_clock::steady::now();
+		const auto tick_start = wall_clock::steady::now();
 		work();
-		std::this_thread::sleep_until(now + min_tick_length);
+
+		const auto next = timing.next(deadline, tick_start, wall_clock::steady::now(), tick_length_);
+		overruns += next.missed_deadlines;
+		deadline = next.deadline;
+		wait_until(deadline);
+	}
+}
+
+main_loop_timing::next_tick main_loop_timing::next(wall_clock::steady::time_point deadline,
+		wall_clock::steady::time_point tick_start,
+		wall_clock::steady::time_point now,
+		wall_clock::steady::duration tick_length) const
+{
+	if (!absolute_deadlines)
+	{
+		const auto next_deadline = tick_start + tick_length;
+		return next_tick{next_deadline, now > next_deadline ? 1u : 0u};
+	}
+
+	const auto next_deadline = deadline + tick_length;
+	if (now <= next_deadline)
+		return next_tick{next_deadline, 0};
+	// skip all deadlines which have passed, but keep the phase.
+	const size_t missed = (now - next_deadline) / tick_length + 1;
+	return next_tick{next_deadline + missed * tick_length, missed};
+}
+
+void cycle_control::wait_until(wall_clock::steady::time_point deadline) const
+{
+	if (timing.spin_time == wall_clock::steady::duration::zero())
+	{
+		std::this_thread::sleep_until(deadline);
+		return;
 	}
+
+	std::this_thread::sleep_until(deadline - timing.spin_time);
+	while (wall_clock::steady::now() < deadline)
+	{
+		// busy wait
+	}
+}
+
+void cycle_control::set_clock_domain(std::shared_ptr<virtual_clock::domain> domain)
+{
+	assert(domain);
+	if (running)
+		throw std::runtime_error{"Main loop is already running"};
+	clock_domain_ = std::move(domain);
+}
+
+void cycle_control::set_main_loop_timing(main_loop_timing new_timing)
+{
+	if (running)
+		throw std::runtime_error{"Main loop is already running"};
+	timing = new_timing;
 }
 
 cycle_control::~cycle_control()
@@ -123,23 +668,31 @@ cycle_control::~cycle_control()
 	stop();
 }
 
-bool cycle_control::run_periodic_tasks(std::vector<periodic_task>& tasks)
+bool cycle_control::run_periodic_tasks(task_bucket& bucket)
 {
-	//todo specify error model
+	auto& tasks = bucket.tasks;
 	for (auto& task : tasks)
-		if (!task.done())
-			if (!error_callback(task))
-			{
-				keep_working.store(false);
-				return false;
-			}
+		if (!task.done() && !handle_overrun(task, bucket))
+			return false;
 
+	const auto dispatch_time = wall_clock::steady::now();
 	for (auto& task : tasks)
 	{
-		task.set_work_to_do(true);
-		task.send_switch_tick();
-		scheduler_->add_task([&task] { task(); });
+		// tasks still running after an overrun have been handled above.
+		if (!task.done())
+			continue;
+		if (task.take_activation())
+		{
+			add_to_batch(task, bucket, dispatch_time);
+		}
+		else if (task.outputs_pending)
+		{
+			// idle event driven region, which has run in its last tick.
+			task.send_output_switch_tick();
+			task.outputs_pending = false;
+		}
 	}
+	dispatch_batch();
 	return true;
 }
 
@@ -148,14 +701,71 @@ void cycle_control::add_task(periodic_task task, virtual_clock::duration tick_ra
 	if (running)
 		throw std::runtime_error{"Worker threads are already running"};
 
-	if (tick_rate == slow_tick)
-		tasks_slow.emplace_back(std::move(task));
-	else if (tick_rate == medium_tick)
-		tasks_medium.emplace_back(std::move(task));
-	else if (tick_rate == fast_tick)
-		tasks_fast.emplace_back(std::move(task));
-	else
+	if (tick_rate <= virtual_clock::duration::zero() ||
+	    tick_rate % tick_length_ != virtual_clock::duration::zero())
 		throw std::invalid_argument{"Unsupported tick_rate"};
+
+	auto bucket = std::find_if(begin(buckets), end(buckets), [tick_rate](auto& b)
+			{
+				return b.tick_rate == tick_rate;
+			});
+	if (bucket == end(buckets))
+	{
+		const uint64_t rate_in_ticks = tick_rate / tick_length_;
+		buckets.push_back(task_bucket{tick_rate, rate_in_ticks, {}, {},
+		                              std::make_unique<completion_latch>()});
+		// due at tick zero, take_due moves it to the first multiple of its rate
+		due_queue.push_back(due_entry{0, buckets.size() - 1});
+		std::push_heap(begin(due_queue), end(due_queue), later);
+		bucket = end(buckets) - 1;
+	}
+	// spread tasks over the workers, each task keeps its worker from tick to tick.
+	if (task.get_worker_affinity() == scheduler::no_affinity)
+		task.set_worker_affinity(nr_of_added_tasks);
+	++nr_of_added_tasks;
+	bucket->tasks.emplace_back(std::move(task));
+	waves_outdated = true;
+	schedule_outdated = true;
+}
+
+void cycle_control::set_overrun_policy(const parallel_region& region, overrun_policy policy)
+{
+	if (running)
+		throw std::runtime_error{"Worker threads are already running"};
+	for (auto& bucket : buckets)
+		for (auto& task : bucket.tasks)
+			if (task.get_region() == &region)
+			{
+				task.set_overrun_policy(policy);
+				return;
+			}
+	throw std::invalid_argument{"No task executes region " + region.get_id().key};
+}
+
+std::vector<cycle_control::task_info> cycle_control::statistics() const
+{
+	std::vector<task_info> result;
+	for (const auto& bucket : buckets)
+		for (const auto& task : bucket.tasks)
+			result.push_back(task_info{task.get_region(), bucket.tick_rate,
+			                           task.statistics().snapshot()});
+	return result;
+}
+
+task_statistics cycle_control::statistics(const parallel_region& region) const
+{
+	for (const auto& bucket : buckets)
+		for (const auto& task : bucket.tasks)
+			if (task.get_region() == &region)
+				return task.statistics().snapshot();
+	throw std::invalid_argument{"No task executes region " + region.get_id().key};
+}
+
+void cycle_control::reset_statistics()
+{
+	for (auto& bucket : buckets)
+		for (auto& task : bucket.tasks)
+			task.statistics().reset();
 }
 
 std::exception_ptr cycle_control::last_exception()
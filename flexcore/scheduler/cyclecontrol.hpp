@@ -4,12 +4,17 @@
 #include <flexcore/scheduler/clock.hpp>
 #include <flexcore/scheduler/scheduler.hpp>
 #include <flexcore/scheduler/parallelregion.hpp>
+#include <flexcore/scheduler/taskstatistics.hpp>
 #include <flexcore/pure/event_sources.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <mutex>
 #include <memory>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -20,10 +25,120 @@ namespace fc
 namespace thread
 {
 
-struct condition_pair
+/**
+ * \brief completion flag of a periodic_task.
+ *
+ * The flag itself is atomic, thus setting and checking it doesn't take a lock.
+ * Only threads waiting for completion with a timeout use mutex and condition variable,
+ * and they are only notified if a waiter is registered.
+ */
+struct completion_flag
+{
+	/// flag to check if work has already been executed this cycle.
+	std::atomic<bool> work_to_do{false};
+	/// number of threads blocked in wait_for.
+	std::atomic<size_t> nr_of_waiters{0};
+	std::mutex mtx;
+	std::condition_variable cv;
+
+	bool done() const { return !work_to_do.load(); }
+
+	void set(bool todo)
+	{
+		// store and load of nr_of_waiters are sequentially consistent
+		// with increment and load in wait_for, thus either the waiter sees the flag,
+		// or we see the waiter and notify it.
+		work_to_do.store(todo);
+		if (!todo && nr_of_waiters.load() != 0)
+		{
+			// acquire lock to not notify between the check of the predicate and the wait.
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+			}
+			cv.notify_all();
+		}
+	}
+
+	template <class duration>
+	bool wait_for(duration timeout)
+	{
+		if (done())
+			return true;
+
+		++nr_of_waiters;
+		bool result = false;
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			result = cv.wait_for(lock, timeout, [this] { return done(); });
+		}
+		--nr_of_waiters;
+		return result;
+	}
+};
+
+/**
+ * \brief counts the running tasks of a group, waiters block until all of them are done.
+ *
+ * Like completion_flag, counting down doesn't take a lock unless a waiter is registered.
+ */
+struct completion_latch
 {
+	std::atomic<size_t> running{0};
+	/// number of threads blocked in wait_for.
+	std::atomic<size_t> nr_of_waiters{0};
 	std::mutex mtx;
 	std::condition_variable cv;
+
+	bool done() const { return running.load() == 0; }
+
+	/// registers nr_of_tasks new running tasks.
+	void add(size_t nr_of_tasks) { running.fetch_add(nr_of_tasks); }
+
+	/// called by each task once it is done.
+	void count_down()
+	{
+		if (running.fetch_sub(1) == 1 && nr_of_waiters.load() != 0)
+		{
+			// acquire lock to not notify between the check of the predicate and the wait.
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+			}
+			cv.notify_all();
+		}
+	}
+
+	template <class duration>
+	bool wait_for(duration timeout)
+	{
+		if (done())
+			return true;
+
+		++nr_of_waiters;
+		bool result = false;
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			result = cv.wait_for(lock, timeout, [this] { return done(); });
+		}
+		--nr_of_waiters;
+		return result;
+	}
+};
+
+/**
+ * \brief reaction of cycle_control to a periodic_task,
+ * which has not finished its last execution when it is due again.
+ */
+enum class overrun_policy
+{
+	/// calls the error callback of cycle_control, which stops the main loop by default.
+	abort,
+	/// drops the execution of this tick, other tasks continue as usual.
+	skip_tick,
+	/**
+	 * \brief delays the execution of this tick until the task is done.
+	 * At most one execution is delayed, further overruns are dropped like skip_tick.
+	 */
+	queue_one
 };
 
 /**
@@ -37,48 +152,31 @@ struct periodic_task final
 	 * \param job task which is to be executed every cycle
 	 */
 	periodic_task(std::function<void(void)> job)
-	    : work_to_do(false)
-	    , sync(std::make_unique<condition_pair>())
+	    : sync(std::make_unique<completion_flag>())
+	    , stats(std::make_unique<task_statistics_collector>())
 	    , work(std::move(job))
 	    , region(nullptr)
 	{
 	}
 	/// Construct a periodic task executes work within a region
 	periodic_task(std::shared_ptr<parallel_region> r) :
-				work_to_do(false),
-				sync(std::make_unique<condition_pair>()),
+				sync(std::make_unique<completion_flag>()),
+				stats(std::make_unique<task_statistics_collector>()),
 				region(r)
 	{
 		work = region->ticks.in_work();
 	}
 
-	bool done()
-	{
-		std::lock_guard<std::mutex> lock(sync->mtx);
-		return !work_to_do;
-	}
+	bool done() const { return sync->done(); }
 
-	void set_work_to_do(bool todo)
-	{
-		{
-			std::lock_guard<std::mutex> lock(sync->mtx);
-			work_to_do = todo;
-		}
-		// if we're done then notify all waiters
-		if (todo == false)
-			sync->cv.notify_all();
-	}
+	void set_work_to_do(bool todo) { sync->set(todo); }
 
 	/** \brief waits for this task to be done, but only until the provided timeout.
 	 * \return true if the task is done.
 	 */
 	bool wait_until_done(virtual_clock::steady::duration timeout)
 	{
-		std::unique_lock<std::mutex> lock(sync->mtx);
-		return sync->cv.wait_for(lock, timeout, [&]
-		                         {
-			                         return !work_to_do;
-		                         });
+		return sync->wait_for(timeout);
 	}
 
 	void send_switch_tick()
@@ -87,31 +185,175 @@ struct periodic_task final
 			region->ticks.switch_buffers();
 	}
 
+	/// switches only the buffers the region reads from, see tick_controller::switch_inputs.
+	void send_input_switch_tick()
+	{
+		if (region)
+			region->ticks.switch_inputs();
+	}
+
+	/// switches only the buffers the region writes to, see tick_controller::switch_outputs.
+	void send_output_switch_tick()
+	{
+		if (region)
+			region->ticks.switch_outputs();
+	}
+
 	void operator()()
 	{
+		const auto start = wall_clock::steady::now();
 		work();
+		stats->record_run(start, wall_clock::steady::now());
+		set_work_to_do(false);
+	}
+
+	/**
+	 * \brief executes work and switches the buffers the region writes to afterwards.
+	 * Used for dependency ordered execution,
+	 * which makes the outputs available to other regions within the same tick.
+	 */
+	void run_and_switch_outputs()
+	{
+		const auto start = wall_clock::steady::now();
+		work();
+		stats->record_run(start, wall_clock::steady::now());
+		if (region)
+			region->ticks.switch_outputs();
 		set_work_to_do(false);
 	}
 
 	const parallel_region* get_region() const { return region.get(); }
+	/**
+	 * \brief checks if the task needs to be executed in the current tick.
+	 * Always true, unless the region of the task is event driven and idle.
+	 */
+	bool take_activation() { return !region || region->take_activation(); }
+	/// sets the reaction to overruns of this task, overrun_policy::abort by default.
+	void set_overrun_policy(overrun_policy p) { policy = p; }
+	overrun_policy get_overrun_policy() const { return policy; }
+	/**
+	 * \brief sets the key of the worker the task prefers to run on.
+	 * Tasks with equal key share a worker, see scheduler::task_hints::affinity.
+	 * cycle_control assigns distinct keys to all tasks without key.
+	 */
+	void set_worker_affinity(size_t key) { affinity = key; }
+	size_t get_worker_affinity() const { return affinity; }
+	/// timing statistics of this task, recorded by operator() and cycle_control.
+	task_statistics_collector& statistics() { return *stats; }
+	const task_statistics_collector& statistics() const { return *stats; }
 private:
-	/// flag to check if work has already been executed this cycle.
-	bool work_to_do;
-	std::unique_ptr<condition_pair> sync;
+	/// held by pointer, as periodic_task needs to be movable.
+	std::unique_ptr<completion_flag> sync;
+	std::unique_ptr<task_statistics_collector> stats;
 	/// work to be done every cycle
 	std::function<void(void)> work;
 
 	std::shared_ptr<parallel_region> region;
+	overrun_policy policy = overrun_policy::abort;
+	size_t affinity = scheduler::no_affinity;
+	/// true if an execution has been delayed by overrun_policy::queue_one.
+	bool queued = false;
+	/**
+	 * \brief true if the outputs of the last execution have not been switched yet.
+	 * Usually they are switched together with the inputs in the next tick,
+	 * but idle event driven regions are not switched at all.
+	 */
+	bool outputs_pending = false;
+	/**
+	 * \brief true while the task is due in the current period of its bucket,
+	 * but has not been dispatched yet, as it waits for its producers.
+	 * Only used with dependency ordered execution, as all following members.
+	 */
+	bool pending = false;
+	/// tasks this task is ordered after, they are in earlier waves and the same or faster buckets.
+	std::vector<const periodic_task*> producers;
+	/// tasks which are ordered after this task.
+	std::vector<const periodic_task*> consumers;
+	/// tasks of all other regions this task depends on, e.g. in slower buckets.
+	std::vector<const periodic_task*> unordered_producers;
+
+	/// true if all producers have run in their current period and are done.
+	bool producers_ready() const
+	{
+		return std::none_of(begin(producers), end(producers),
+				[](const periodic_task* p) { return p->pending || !p->done(); });
+	}
+	/**
+	 * \brief true if no unordered producer is running,
+	 * thus the inputs of this task can be switched safely.
+	 */
+	bool unordered_producers_done() const
+	{
+		return std::all_of(begin(unordered_producers), end(unordered_producers),
+				[](const periodic_task* p) { return p->done(); });
+	}
+	/// true if a consumer is waiting for this task in the current tick.
+	bool consumers_pending() const
+	{
+		return std::any_of(begin(consumers), end(consumers),
+				[](const periodic_task* c) { return c->pending; });
+	}
+	bool event_driven() const { return region && region->event_driven(); }
+	friend class cycle_control;
+};
+
+/**
+ * \brief Timing options of the realtime main loop of cycle_control.
+ *
+ * The defaults reproduce the simple loop,
+ * which sleeps for one tick length after the start of every tick.
+ */
+struct main_loop_timing
+{
+	/**
+	 * \brief start ticks at the absolute deadlines t0 + n * tick_length.
+	 *
+	 * If false, every tick waits one tick length relative to its own start,
+	 * thus any delay of a tick shifts all following ticks.
+	 */
+	bool absolute_deadlines = false;
+	/**
+	 * \brief wake up this much before a deadline and busy-wait for the rest.
+	 *
+	 * Trades cpu time of the main loop thread for precision,
+	 * as the operating system might wake up a sleeping thread late.
+	 */
+	wall_clock::steady::duration spin_time = wall_clock::steady::duration::zero();
+
+	/// deadline of the next tick together with the number of deadlines missed on the way.
+	struct next_tick
+	{
+		wall_clock::steady::time_point deadline;
+		size_t missed_deadlines;
+	};
+	/**
+	 * \brief computes when the tick after the current one starts.
+	 *
+	 * With absolute deadlines, all deadlines which have passed at now are missed
+	 * and the next tick starts at the first deadline in the future.
+	 * Otherwise the next tick is due one tick length after tick_start
+	 * and a late tick counts as one missed deadline.
+	 * \param deadline deadline of the current tick.
+	 * \param tick_start time the current tick has actually started.
+	 * \param now time the work of the current tick is done.
+	 */
+	next_tick next(wall_clock::steady::time_point deadline,
+	               wall_clock::steady::time_point tick_start,
+	               wall_clock::steady::time_point now,
+	               wall_clock::steady::duration tick_length) const;
 };
 
 /**
  * \brief Controls timing and the execution of cyclic tasks in the scheduler.
+ *
+ * The length of a single tick (the base period) is set on construction,
+ * all tick rates of tasks need to be multiples of it.
  * Todo: allow to set virtual clock as control clock for replay as template parameter
- * todo: allow to set min_tick_length
  */
 class cycle_control
 {
 public:
+	/// default length of a single tick
 	static constexpr wall_clock::steady::duration min_tick_length =
 			wall_clock::steady::duration(std::chrono::milliseconds(10));
 
@@ -119,12 +361,83 @@ public:
 	static constexpr virtual_clock::steady::duration medium_tick = min_tick_length * 10;
 	static constexpr virtual_clock::steady::duration slow_tick = min_tick_length * 100;
 
-	explicit cycle_control(std::unique_ptr<scheduler> scheduler);
-	template <class ErrorFun>
+	/**
+	 * \param scheduler executes the tasks
+	 * \param tick_length length of a single tick, by which the virtual clock is advanced.
+	 * \throws std::invalid_argument if tick_length is not positive.
+	 */
+	explicit cycle_control(std::unique_ptr<scheduler> scheduler,
+	                       wall_clock::steady::duration tick_length = min_tick_length);
+	template <class ErrorFun, class = std::enable_if_t<
+	              !std::is_convertible<ErrorFun, wall_clock::steady::duration>{}>>
 	cycle_control(std::unique_ptr<scheduler> scheduler, ErrorFun err);
+	template <class ErrorFun>
+	cycle_control(std::unique_ptr<scheduler> scheduler,
+	              wall_clock::steady::duration tick_length, ErrorFun err);
 	~cycle_control();
 
-	/// starts the main loop
+	/// length of a single tick of this cycle_control
+	wall_clock::steady::duration tick_length() const { return tick_length_; }
+
+	/**
+	 * \brief sets the virtual clock domain, which is advanced by this cycle_control.
+	 *
+	 * The domain is current in the main loop, in work() and in all tasks,
+	 * thus the tasks see the time of this domain.
+	 * Uses the global domain by default.
+	 * \pre domain != nullptr
+	 * \throws std::runtime_error if the cycle_control is already running.
+	 */
+	void set_clock_domain(std::shared_ptr<virtual_clock::domain> domain);
+	virtual_clock::domain& clock_domain() const { return *clock_domain_; }
+
+	/**
+	 * \brief sets the timing of the realtime main loop.
+	 * \throws std::runtime_error if the cycle_control is already running.
+	 */
+	void set_main_loop_timing(main_loop_timing timing);
+	/**
+	 * \brief number of deadlines the realtime main loop has missed,
+	 * as the work of the previous tick was not finished in time.
+	 *
+	 * Without absolute deadlines, the next tick starts late and counts as one missed deadline.
+	 * With absolute deadlines, all deadlines which have passed are skipped and counted,
+	 * the loop continues with the next deadline in the future, thus keeps its phase.
+	 */
+	size_t nr_of_overruns() const { return overruns.load(); }
+
+	/**
+	 * \brief enables execution of regions in the order of their dependencies.
+	 *
+	 * All tasks due in a tick are executed in waves.
+	 * A region starts only after all regions it depends on in the same or a faster bucket
+	 * have run in their current period and are done, and receives their outputs,
+	 * thus a chain of N regions produces output within one period instead of N periods.
+	 * Producers which are not due in this tick count as switched already.
+	 * Dependencies on regions in slower buckets are not ordered,
+	 * as waiting for them would stall the faster bucket.
+	 * Regions in dependency cycles and all regions depending on them
+	 * are executed in a final wave, connections among them keep the delay of one tick.
+	 *
+	 * The main loop only waits for producers of buckets which are due in every tick.
+	 * Consumers of producers in slower buckets are dispatched in a later tick,
+	 * as soon as their producers are done.
+	 * If a region is still waiting for its producers when it is due again,
+	 * e.g. as a producer with overrun_policy::skip_tick or overrun_policy::queue_one
+	 * is late, the period is counted as skipped tick of the region.
+	 *
+	 * A producer switches its outputs right after its work tick, on its worker thread.
+	 * While an unordered producer is running, its consumers are executed
+	 * without switching their inputs, event driven consumers are not executed,
+	 * thus inputs and outputs are never switched at the same time.
+	 *
+	 * \param dependencies dependencies between the regions of the periodic tasks,
+	 * usually taken from graph::connection_graph::region_dependencies.
+	 * \throws std::runtime_error if the cycle_control is already running.
+	 */
+	void set_region_dependencies(std::vector<region_dependency> dependencies);
+
+	/// builds the schedule of all tasks and starts the main loop
 	void start(bool fast=false);
 	/// stops the main loop in all threads
 	void stop();
@@ -132,32 +445,210 @@ public:
 	/// advances the clock by a single tick and executes all tasks for the cycle.
 	void work();
 
+	/**
+	 * \brief executes a single tick of a replay and waits until all tasks are done.
+	 *
+	 * Like work(), but sets the virtual system clock to the recorded timestamp
+	 * and returns only after all tasks have finished, independent of the wall clock.
+	 * As every tick is completed before the next one starts,
+	 * replaying the same timestamps gives the same results on every run.
+	 * The steady virtual clock still advances by tick_length() per tick.
+	 *
+	 * \pre timestamps of consecutive calls are not decreasing.
+	 * \throws std::runtime_error if the main loop is running.
+	 */
+	void replay_tick(virtual_clock::system::time_point timestamp);
+
+	/**
+	 * \brief replays a recorded stream of timestamps, one tick per timestamp.
+	 * \param first, last range of virtual_clock::system::time_point
+	 * \throws the exceptions of failed tasks, after the tick in which they failed.
+	 */
+	template <class iter>
+	void replay(iter first, iter last);
+
 	/**
 	 * \brief adds a new cyclic task with the given tick_rate.
 	 * Tasks can only be added as long as the cycle_control has not been started. A
 	 * std::runtime_error exception will be thrown if an attempt is made to add a task to a running
 	 * cycle_control.
+	 * Any positive integer multiple of tick_length() is a valid tick_rate,
+	 * otherwise std::invalid_argument is thrown.
 	 *
 	 * \pre cycle_control is not running
 	 * \post list of tasks for given tick_rate is not empty
 	 */
 	void add_task(periodic_task task, virtual_clock::duration tick_rate);
+	/**
+	 * \brief sets the reaction to overruns of the task executing region.
+	 * \throws std::invalid_argument if no task of this cycle_control executes region.
+	 * \throws std::runtime_error if the cycle_control is already running.
+	 */
+	void set_overrun_policy(const parallel_region& region, overrun_policy policy);
 	size_t nr_of_tasks() { return scheduler_->nr_of_waiting_tasks(); }
 
+	/// statistics of a single periodic task together with the task it belongs to.
+	struct task_info
+	{
+		/// region of the task, nullptr for tasks without region.
+		const parallel_region* region;
+		virtual_clock::duration tick_rate;
+		task_statistics statistics;
+	};
+	/// snapshot of the timing statistics of all periodic tasks.
+	std::vector<task_info> statistics() const;
+	/**
+	 * \brief snapshot of the timing statistics of the task executing region.
+	 * \throws std::invalid_argument if no task of this cycle_control executes region.
+	 */
+	task_statistics statistics(const parallel_region& region) const;
+	/// resets the statistics of all tasks, \pre cycle_control is not running.
+	void reset_statistics();
+
 	std::exception_ptr last_exception();
 
 private:
 	/// normal main loop, which run tasks and sticks to tick lengths
 	void normal_main_loop();
+	/// waits until deadline, as specified by timing
+	void wait_until(wall_clock::steady::time_point deadline) const;
 	/// accelerated main loop, which maintains ratios of execution counts of tasks
 	void fast_main_loop();
-	/// runs the tasks in this vector; returns false if any task is not done, true otherwise
-	bool run_periodic_tasks(std::vector<periodic_task>& tasks);
+	/// executes all tasks due at tick, the clock has to be advanced by the caller.
+	void run_tick(uint64_t tick);
+	/// waits until all tasks are done, without timeout.
+	void wait_for_all_tasks();
+	struct task_bucket;
+	/// runs the tasks of bucket; returns false if the main loop has to stop, true otherwise
+	bool run_periodic_tasks(task_bucket& bucket);
+	/**
+	 * \brief applies the overrun_policy of task, which is not done when it is due.
+	 * \return false if the main loop has to stop.
+	 */
+	bool handle_overrun(periodic_task& task, task_bucket& bucket);
+	/// dispatches all tasks delayed by overrun_policy::queue_one, which are done by now.
+	void run_queued_tasks();
+	/**
+	 * \brief adds task of bucket to batch, the tick rate of bucket gives its deadline.
+	 * \param switch_inputs false to execute task without switching its inputs,
+	 * only possible with dependency ordered execution.
+	 */
+	void add_to_batch(periodic_task& task, task_bucket& bucket,
+			wall_clock::steady::time_point dispatch_time, bool switch_inputs = true);
+	/// hands batch to the scheduler and clears it.
+	void dispatch_batch();
+	/// runs the tasks of all due buckets in waves; returns false if a task failed.
+	bool run_waves();
+	/// dispatches all pending tasks, whose producers are ready, in waves.
+	bool dispatch_waves();
+	/// assigns every task to its wave according to region_dependencies.
+	void update_waves();
 	void wait_for_current_tasks();
-	std::vector<periodic_task> tasks_slow;
-	std::vector<periodic_task> tasks_medium;
-	std::vector<periodic_task> tasks_fast;
+
+	/// periodic tasks which share the same tick rate.
+	struct task_bucket
+	{
+		virtual_clock::duration tick_rate;
+		/// tick_rate in multiples of tick_length
+		uint64_t rate_in_ticks;
+		std::vector<periodic_task> tasks;
+		/// indices of tasks per wave, only used with dependency ordered execution.
+		std::vector<std::vector<size_t>> waves;
+		/// counts the running tasks of this bucket, held by pointer to keep the bucket movable.
+		std::unique_ptr<completion_latch> latch;
+		/// number of tasks with periodic_task::pending set.
+		size_t nr_of_pending = 0;
+	};
+	/// task delayed by overrun_policy::queue_one, by index as buckets may still grow.
+	struct queued_task
+	{
+		size_t bucket;
+		size_t task;
+	};
+	/// task of the current wave together with its bucket, whose tick rate is the timeout.
+	struct running_task
+	{
+		periodic_task* task;
+		task_bucket* bucket;
+		/// false if an unordered producer of task is running.
+		bool switch_inputs;
+	};
+	/// entry of due_queue, marks bucket as due at tick due_tick.
+	struct due_entry
+	{
+		uint64_t due_tick;
+		size_t bucket;
+	};
+	/// index of the current tick of the virtual clock in multiples of tick_length.
+	uint64_t current_tick() const;
+	/**
+	 * \brief precomputes the buckets due in every tick of the hyperperiod.
+	 *
+	 * The hyperperiod is the least common multiple of the rates of all buckets,
+	 * after it the pattern of due buckets repeats.
+	 * If it exceeds max_hyperperiod, no table is built and due_queue is used instead.
+	 */
+	void build_schedule();
+	/**
+	 * \brief stores the indices of all buckets due at tick in due_now, slowest rate first.
+	 *
+	 * Looks them up in the schedule table, or takes them from due_queue without table.
+	 * Buckets which have missed their due tick are moved to their next due tick >= tick.
+	 * The entries taken from due_queue are stored in taken_entries and need to be given back to
+	 * due_queue by reschedule_due.
+	 */
+	void take_due(uint64_t tick);
+	/**
+	 * \brief puts entries taken by take_due back into due_queue.
+	 * \param advance if true, buckets due at tick are scheduled for their next period.
+	 */
+	void reschedule_due(uint64_t tick, bool advance);
+	/**
+	 * \brief calls the error callback for all late tasks of bucket with overrun_policy::abort.
+	 * \returns false if the main loop has to stop.
+	 */
+	bool handle_late_tasks(task_bucket& bucket);
+
+	/// one bucket per distinct tick rate
+	std::vector<task_bucket> buckets;
+	/// upper limit of the length of the schedule table in ticks.
+	static constexpr uint64_t max_hyperperiod = 1 << 16;
+	/// length of the schedule table in ticks, zero if due_queue is used instead.
+	uint64_t hyperperiod = 0;
+	/// true if tasks have been added since the schedule table has been built.
+	bool schedule_outdated = true;
+	/**
+	 * \brief buckets due at tick t of the hyperperiod are
+	 * [schedule_buckets[schedule_offsets[t]], schedule_buckets[schedule_offsets[t + 1]])
+	 */
+	std::vector<size_t> schedule_offsets;
+	std::vector<size_t> schedule_buckets;
+	/// min-heap of the next tick each bucket is due, contains one entry per bucket.
+	std::vector<due_entry> due_queue;
+	/// scratch storage for take_due, kept as members to avoid allocations every tick
+	std::vector<due_entry> taken_entries;
+	std::vector<size_t> due_now;
+	/// tasks of one bucket, which are added to the scheduler as a single batch.
+	std::vector<scheduler::task_t> batch;
+	/// hints of each task in batch, the deadline is the end of the period of its bucket.
+	std::vector<scheduler::task_hints> batch_hints;
+	/// number of tasks added so far, used as default worker affinity.
+	size_t nr_of_added_tasks = 0;
+	/// true if tasks are executed in waves ordered by region_dependencies.
+	bool dependency_ordered = false;
+	std::vector<region_dependency> region_dependencies;
+	size_t nr_of_waves = 0;
+	/// true if tasks or dependencies changed since waves have been computed.
+	bool waves_outdated = true;
+	/// scratch storage for run_waves
+	std::vector<running_task> wave_tasks;
+	/// tasks with a delayed execution, see overrun_policy::queue_one
+	std::vector<queued_task> queued_tasks;
 	std::unique_ptr<scheduler> scheduler_;
+	wall_clock::steady::duration tick_length_;
+	std::shared_ptr<virtual_clock::domain> clock_domain_;
+	main_loop_timing timing;
+	std::atomic<size_t> overruns{0};
 	std::atomic<bool> keep_working{false};
 	bool running = false;
 	//Todo refactor main loop and task queue to locked class together
@@ -174,11 +665,35 @@ private:
 	bool store_exception(periodic_task& task);
 };
 
-template <class ErrorFun>
+template <class ErrorFun, class>
 inline cycle_control::cycle_control(std::unique_ptr<scheduler> scheduler, ErrorFun err)
-    : scheduler_(std::move(scheduler)), error_callback(std::move(err))
+    : cycle_control(std::move(scheduler), min_tick_length, std::move(err))
+{
+}
+
+template <class ErrorFun>
+inline cycle_control::cycle_control(std::unique_ptr<scheduler> scheduler,
+                                    wall_clock::steady::duration tick_length, ErrorFun err)
+    : scheduler_(std::move(scheduler))
+    , tick_length_(tick_length)
+    // global domain is not owned, thus aliasing an empty shared_ptr.
+    , clock_domain_(std::shared_ptr<void>{}, &virtual_clock::domain::global())
+    , error_callback(std::move(err))
 {
 	assert(scheduler_);
+	if (tick_length_ <= wall_clock::steady::duration::zero())
+		throw std::invalid_argument{"tick_length needs to be positive"};
+}
+
+template <class iter>
+void cycle_control::replay(iter first, iter last)
+{
+	for (; first != last; ++first)
+	{
+		replay_tick(*first);
+		if (auto ex = last_exception())
+			std::rethrow_exception(ex);
+	}
 }
 
 } /* namespace thread */
@@ -0,0 +1,154 @@
+#include <flexcore/scheduler/deadlinescheduler.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace fc
+{
+namespace thread
+{
+
+namespace
+{
+/// heap order, the task with the earliest deadline is at the front.
+template <class queued_task>
+bool later(const queued_task& lhs, const queued_task& rhs)
+{
+	if (lhs.deadline != rhs.deadline)
+		return lhs.deadline > rhs.deadline;
+	return lhs.sequence > rhs.sequence;
+}
+}
+
+deadline_scheduler::deadline_scheduler() :
+		deadline_scheduler(thread_pool_config{})
+{
+}
+
+deadline_scheduler::deadline_scheduler(const thread_pool_config& config)
+{
+	start(config.resolved_nr_of_threads());
+	try
+	{
+		for (size_t i = 0; i != thread_pool.size(); ++i)
+			config.apply(thread_pool[i], i);
+	}
+	catch (...)
+	{
+		//destructor is not called if constructor throws, running threads need to be joined.
+		stop();
+		throw;
+	}
+}
+
+void deadline_scheduler::start(size_t nr_of_threads) noexcept
+{
+	do_work = true;
+	for (size_t i = 0; i != nr_of_threads; ++i)
+		thread_pool.push_back(std::thread([this] () { work_loop(); }));
+	assert(!thread_pool.empty()); //check invariant
+}
+
+void deadline_scheduler::work_loop()
+{
+	while (true)
+	{
+		task_t task;
+		{
+			queue_lock lock(task_queue_mutex);
+			thread_control.wait(lock, [this]
+					{
+						return !do_work || !task_queue.empty();
+					});
+			if (!do_work)
+				return;
+
+			std::pop_heap(begin(task_queue), end(task_queue), later<queued_task>);
+			task = std::move(task_queue.back().task);
+			task_queue.pop_back();
+		}
+		if (task)
+			task();
+	}
+}
+
+void deadline_scheduler::push(task_t task, deadline_t deadline)
+{
+	task_queue.push_back(queued_task{deadline, next_sequence++, std::move(task)});
+	std::push_heap(begin(task_queue), end(task_queue), later<queued_task>);
+}
+
+void deadline_scheduler::notify(size_t nr_of_new_tasks)
+{
+	if (nr_of_new_tasks == 1)
+		thread_control.notify_one();
+	else if (nr_of_new_tasks != 0)
+		thread_control.notify_all();
+}
+
+void deadline_scheduler::add_task(task_t new_task)
+{
+	{
+		queue_lock lock(task_queue_mutex);
+		push(std::move(new_task), deadline_t::max());
+	}
+	notify(1);
+}
+
+void deadline_scheduler::add_tasks(std::vector<task_t>& new_tasks)
+{
+	{
+		queue_lock lock(task_queue_mutex);
+		for (auto& task : new_tasks)
+			push(std::move(task), deadline_t::max());
+	}
+	notify(new_tasks.size());
+}
+
+void deadline_scheduler::add_tasks_with_hints(std::vector<task_t>& new_tasks,
+		const std::vector<task_hints>& hints)
+{
+	assert(new_tasks.size() == hints.size());
+	{
+		queue_lock lock(task_queue_mutex);
+		for (size_t i = 0; i != new_tasks.size(); ++i)
+			push(std::move(new_tasks[i]), hints[i].deadline);
+	}
+	notify(new_tasks.size());
+}
+
+void deadline_scheduler::stop() noexcept
+{
+	//first stop the infinite loop in all threads
+	{
+		//Acquire lock first, to stop work loops to enter while we set the flag.
+		queue_lock lock(task_queue_mutex);
+		do_work = false;
+	}
+	thread_control.notify_all();
+	//then stop all calculations and join threads
+	for (auto& thread : thread_pool)
+	{
+		if (thread.joinable())
+		{
+			thread.join();
+		}
+	}
+	assert(!thread_pool.empty()); //check invariant
+}
+
+deadline_scheduler::~deadline_scheduler()
+{
+	//first stop all threads, destroying running threads is illegal
+	stop();
+}
+
+size_t deadline_scheduler::nr_of_waiting_tasks() const
+{
+	queue_lock lock(task_queue_mutex);
+	return task_queue.size();
+}
+
+} /* namespace thread */
+} /* namespace fc */
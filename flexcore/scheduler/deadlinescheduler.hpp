@@ -0,0 +1,87 @@
+#ifndef SRC_SCHEDULER_DEADLINESCHEDULER_HPP_
+#define SRC_SCHEDULER_DEADLINESCHEDULER_HPP_
+
+#include <flexcore/scheduler/scheduler.hpp>
+#include <flexcore/scheduler/threadconfig.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fc
+{
+namespace thread
+{
+
+/**
+ * \brief scheduler based on a threadpool, which executes the task with the earliest deadline first.
+ *
+ * cycle_control passes the end of the current period of every task as its deadline,
+ * thus tasks with short tick rates overtake tasks with long tick rates,
+ * which have been queued before them.
+ * Tasks with equal deadlines and tasks added without deadline are executed in FIFO order,
+ * tasks without deadline after all tasks with deadline.
+ * Running tasks are not preempted, a long task only blocks the thread it runs on.
+ *
+ * Can be used as a drop-in replacement for parallel_scheduler in cycle_control.
+ *
+ * \invariant thread_pool.size() > 0
+ */
+class deadline_scheduler : public scheduler
+{
+public:
+	deadline_scheduler();
+	/**
+	 * \brief creates thread pool with number, affinity and priority of threads given by config.
+	 * \throws std::system_error if the configuration cannot be applied to the threads.
+	 */
+	explicit deadline_scheduler(const thread_pool_config& config);
+	deadline_scheduler(const deadline_scheduler&) = delete;
+	~deadline_scheduler() override;
+
+	/// adds a new task without deadline and notifies waiting threads.
+	void add_task(task_t new_task) override;
+	/// adds all tasks without deadline under a single lock.
+	void add_tasks(std::vector<task_t>& new_tasks) override;
+	/// adds all tasks with their deadline under a single lock, affinities are ignored.
+	void add_tasks_with_hints(std::vector<task_t>& new_tasks,
+			const std::vector<task_hints>& hints) override;
+	/// stops the work loop of all threads
+	void stop() noexcept override;
+	size_t nr_of_waiting_tasks() const override;
+
+private:
+	struct queued_task
+	{
+		deadline_t deadline;
+		/// order of insertion, keeps tasks with equal deadline in FIFO order.
+		uint64_t sequence;
+		task_t task;
+	};
+	typedef std::unique_lock<std::mutex> queue_lock;
+
+	/// starts the work loop of all threads
+	void start(size_t nr_of_threads) noexcept;
+	/// infinite work loop of a worker thread
+	void work_loop();
+	/// \pre task_queue_mutex is held by the caller
+	void push(task_t task, deadline_t deadline);
+	void notify(size_t nr_of_new_tasks);
+
+	std::vector<std::thread> thread_pool;
+	bool do_work = false; ///< flag indicates threads to keep working.
+
+	/// min-heap ordered by deadline and sequence.
+	std::vector<queued_task> task_queue;
+	uint64_t next_sequence = 0;
+	mutable std::mutex task_queue_mutex;
+	///used to notify worker threads if new tasks are available
+	std::condition_variable thread_control;
+};
+
+} /* namespace thread */
+} /* namespace fc */
+
+#endif /* SRC_SCHEDULER_DEADLINESCHEDULER_HPP_ */
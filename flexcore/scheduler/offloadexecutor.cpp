@@ -0,0 +1,190 @@
+#include <flexcore/scheduler/offloadexecutor.hpp>
+
+#include <cassert>
+#include <stdexcept>
+
+namespace fc
+{
+namespace thread
+{
+
+constexpr size_t offload_executor::default_capacity;
+
+offload_executor::offload_executor(const thread_pool_config& config, size_t capacity)
+	: capacity_(capacity)
+	, exceptions(std::make_shared<exception_store>())
+{
+	if (capacity == 0)
+		throw std::invalid_argument{"Capacity of offload_executor needs to be positive"};
+
+	const auto nr_of_threads = config.resolved_nr_of_threads();
+	do_work = true;
+	for (size_t i = 0; i != nr_of_threads; ++i)
+		thread_pool.push_back(std::thread([this] { work_loop(); }));
+	try
+	{
+		for (size_t i = 0; i != thread_pool.size(); ++i)
+			config.apply(thread_pool[i], i);
+	}
+	catch (...)
+	{
+		//destructor is not called if constructor throws, running threads need to be joined.
+		stop();
+		throw;
+	}
+	assert(!thread_pool.empty()); //check invariant
+}
+
+offload_executor::~offload_executor()
+{
+	stop();
+}
+
+void offload_executor::stop() noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(task_queue_mutex);
+		do_work = false;
+		task_queue.clear();
+	}
+	thread_control.notify_all();
+	for (auto& thread : thread_pool)
+		if (thread.joinable())
+			thread.join();
+}
+
+void offload_executor::work_loop()
+{
+	while (true)
+	{
+		task_t task;
+		{
+			std::unique_lock<std::mutex> lock(task_queue_mutex);
+			thread_control.wait(lock, [this] { return !do_work || !task_queue.empty(); });
+			if (!do_work)
+				return;
+			task = std::move(task_queue.front());
+			task_queue.pop_front();
+		}
+		task();
+	}
+}
+
+bool offload_executor::try_add(task_t task)
+{
+	{
+		std::lock_guard<std::mutex> lock(task_queue_mutex);
+		if (task_queue.size() >= capacity_)
+			return false;
+		task_queue.push_back(std::move(task));
+	}
+	thread_control.notify_one();
+	return true;
+}
+
+size_t offload_executor::nr_of_waiting_tasks() const
+{
+	std::lock_guard<std::mutex> lock(task_queue_mutex);
+	return task_queue.size();
+}
+
+void offload_executor::add_region(parallel_region& region)
+{
+	std::lock_guard<std::mutex> lock(mailbox_mutex);
+	auto& entry = mailboxes[&region];
+	auto box = entry.lock();
+	// a mailbox kept alive by running work might belong to a destroyed region at this address.
+	if (box && box->region_pending == region.pending_events())
+		return;
+
+	// mailboxes of destroyed regions are removed, when new ones are created.
+	for (auto it = mailboxes.begin(); it != mailboxes.end();)
+	{
+		if (it->second.expired() && &it->second != &entry)
+			it = mailboxes.erase(it);
+		else
+			++it;
+	}
+	box = std::make_shared<mailbox>();
+	box->region_pending = region.pending_events();
+	box->errors = exceptions;
+	// the switch tick holds the mailbox, as it might outlive the executor.
+	region.switch_tick() >> [box] { box->deliver(); };
+	entry = box;
+}
+
+std::shared_ptr<offload_executor::mailbox>
+offload_executor::mailbox_of(const parallel_region& region)
+{
+	std::lock_guard<std::mutex> lock(mailbox_mutex);
+	const auto entry = mailboxes.find(&region);
+	if (entry == mailboxes.end())
+		return nullptr;
+	auto box = entry->second.lock();
+	if (!box || box->region_pending != region.pending_events())
+		return nullptr;
+	return box;
+}
+
+void offload_executor::mailbox::post(task_t completion)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		completions.push_back(std::move(completion));
+	}
+	has_mail.store(true, std::memory_order_release);
+	region_pending->store(true, std::memory_order_release);
+}
+
+void offload_executor::mailbox::deliver()
+{
+	// checked without lock, as most switch ticks have no mail.
+	if (!has_mail.exchange(false, std::memory_order_acquire))
+		return;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		swap(completions, delivering);
+	}
+	for (auto& completion : delivering)
+	{
+		// a throwing completion must neither stop the switch tick nor drop the others.
+		try
+		{
+			completion();
+		}
+		catch (...)
+		{
+			errors->push(std::current_exception());
+		}
+	}
+	delivering.clear();
+}
+
+void offload_executor::store_exception(std::exception_ptr exception)
+{
+	exceptions->push(exception);
+}
+
+std::exception_ptr offload_executor::last_exception()
+{
+	return exceptions->pop();
+}
+
+void offload_executor::exception_store::push(std::exception_ptr exception)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	exceptions.push_back(exception);
+}
+
+std::exception_ptr offload_executor::exception_store::pop()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (exceptions.empty())
+		return nullptr;
+	auto result = exceptions.back();
+	exceptions.pop_back();
+	return result;
+}
+
+} /* namespace thread */
+} /* namespace fc */
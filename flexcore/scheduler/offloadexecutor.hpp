@@ -0,0 +1,188 @@
+#ifndef SRC_SCHEDULER_OFFLOADEXECUTOR_HPP_
+#define SRC_SCHEDULER_OFFLOADEXECUTOR_HPP_
+
+#include <flexcore/core/small_function.hpp>
+#include <flexcore/scheduler/parallelregion.hpp>
+#include <flexcore/scheduler/threadconfig.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fc
+{
+namespace thread
+{
+
+/**
+ * \brief thread pool for blocking work of nodes, like file I/O or long computations.
+ *
+ * Work is executed outside of the cyclic schedule, thus it never delays a region.
+ * Its completion is handed back to the region the work has been offloaded from
+ * and executed on the next switch tick of this region,
+ * thus completions run in the region and need no synchronization with its nodes.
+ * Event driven regions are activated by completions.
+ * Regions need to be added with add_region, before work can be offloaded from them.
+ *
+ * The queue of waiting work is bounded, offload fails instead of queueing more work.
+ *
+ * \invariant thread_pool.size() > 0
+ */
+class offload_executor
+{
+public:
+	/// move-only task, see scheduler::task_t
+	typedef small_function<void(void)> task_t;
+
+	/// default number of waiting work items per executor.
+	static constexpr size_t default_capacity = 64;
+
+	/**
+	 * \brief creates thread pool with number, affinity and priority of threads given by config.
+	 * \param capacity maximum number of work items waiting for a thread.
+	 * \throws std::system_error if the configuration cannot be applied to the threads.
+	 * \throws std::invalid_argument if capacity is zero.
+	 */
+	explicit offload_executor(const thread_pool_config& config = thread_pool_config{},
+	                          size_t capacity = default_capacity);
+	offload_executor(const offload_executor&) = delete;
+	/// waits for running work, discards waiting work.
+	~offload_executor();
+
+	/**
+	 * \brief prepares region to receive completions on its switch tick.
+	 *
+	 * Connects to the switch tick of region, which is not thread safe.
+	 * Thus the switch tick of region may not be fired concurrently,
+	 * call it before the scheduler is started, or from within region.
+	 * Adding a region again has no effect.
+	 */
+	void add_region(parallel_region& region);
+
+	/**
+	 * \brief executes work on a thread of this executor
+	 * and calls completion with its result on the next switch tick of region afterwards.
+	 *
+	 * If work throws, completion is not called and the exception is stored,
+	 * see last_exception. Exceptions thrown by completion are stored as well.
+	 * Completions of regions destroyed in the meantime are dropped.
+	 * \param region region which executes completion, usually the region of the calling node.
+	 * \param work callable without parameters, may be move-only.
+	 * \param completion callable taking the result of work, or no parameter for void results.
+	 * \returns false if the queue is full and work has been discarded.
+	 * \throws std::invalid_argument if region has not been added, see add_region.
+	 */
+	template <class work_t, class completion_t>
+	bool offload(parallel_region& region, work_t work, completion_t completion);
+
+	/// number of work items waiting for a thread.
+	size_t nr_of_waiting_tasks() const;
+	size_t capacity() const { return capacity_; }
+	/// takes the latest exception thrown by offloaded work or completions, nullptr if there is none.
+	std::exception_ptr last_exception();
+
+private:
+	/// exceptions of work and completions, shared with the mailboxes which might outlive the executor.
+	struct exception_store
+	{
+		void push(std::exception_ptr exception);
+		/// takes the latest exception, nullptr if there is none.
+		std::exception_ptr pop();
+
+		std::mutex mutex;
+		std::deque<std::exception_ptr> exceptions;
+	};
+
+	/// completions waiting for the switch tick of a single region.
+	struct mailbox
+	{
+		/// queues completion and activates the region.
+		void post(task_t completion);
+		/// executes all completions posted so far, called on the switch tick of the region.
+		void deliver();
+
+		/// pending flag of the region, also identifies the region, as it is unique per region.
+		std::shared_ptr<std::atomic<bool>> region_pending;
+		std::shared_ptr<exception_store> errors;
+		std::atomic<bool> has_mail{false};
+		std::mutex mutex;
+		std::vector<task_t> completions;
+		/// completions taken out of the mailbox by deliver, kept to reuse the memory.
+		std::vector<task_t> delivering;
+	};
+
+	/**
+	 * \brief mailbox of region, created and connected to its switch tick by add_region.
+	 * The switch tick owns the mailbox, thus it is destroyed together with the region.
+	 * \returns nullptr if region has not been added.
+	 */
+	std::shared_ptr<mailbox> mailbox_of(const parallel_region& region);
+	bool try_add(task_t task);
+	void work_loop();
+	/// stops and joins all threads, discards waiting work.
+	void stop() noexcept;
+	void store_exception(std::exception_ptr exception);
+
+	template <class work_t, class completion_t>
+	static task_t bind_result(work_t& work, completion_t& completion, std::false_type /*void*/)
+	{
+		return [completion = std::move(completion), result = work()]() mutable
+		{
+			completion(std::move(result));
+		};
+	}
+	template <class work_t, class completion_t>
+	static task_t bind_result(work_t& work, completion_t& completion, std::true_type /*void*/)
+	{
+		work();
+		return std::move(completion);
+	}
+
+	const size_t capacity_;
+	std::vector<std::thread> thread_pool;
+	bool do_work = false;
+	std::deque<task_t> task_queue;
+	mutable std::mutex task_queue_mutex;
+	std::condition_variable thread_control;
+
+	std::mutex mailbox_mutex;
+	/// not owning, as a new region might be created at the address of a destroyed one.
+	std::map<const parallel_region*, std::weak_ptr<mailbox>> mailboxes;
+
+	std::shared_ptr<exception_store> exceptions;
+};
+
+template <class work_t, class completion_t>
+bool offload_executor::offload(parallel_region& region, work_t work, completion_t completion)
+{
+	using result_t = decltype(work());
+	auto box = mailbox_of(region);
+	if (!box)
+		throw std::invalid_argument{"Region " + region.get_id().key
+				+ " has not been added to the offload_executor"};
+	return try_add([this, box, work = std::move(work), completion = std::move(completion)]() mutable
+	{
+		try
+		{
+			box->post(bind_result(work, completion, std::is_void<result_t>{}));
+		}
+		catch (...)
+		{
+			store_exception(std::current_exception());
+		}
+	});
+}
+
+} /* namespace thread */
+} /* namespace fc */
+
+#endif /* SRC_SCHEDULER_OFFLOADEXECUTOR_HPP_ */
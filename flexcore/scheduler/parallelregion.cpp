@@ -22,10 +22,20 @@ region_id parallel_region::get_id() const
 
 parallel_region::parallel_region(std::string id_) :
 		ticks(),
-		id({std::move(id_)})
+		id({std::move(id_)}),
+		pending_events_(std::make_shared<std::atomic<bool>>(false))
 {
 }
 
+bool parallel_region::take_activation()
+{
+	if (!event_driven_)
+		return true;
+	// relaxed load first, to not write the cache line of the flag in idle ticks.
+	return pending_events_->load(std::memory_order_relaxed)
+			&& pending_events_->exchange(false, std::memory_order_acquire);
+}
+
 std::shared_ptr<parallel_region>
 parallel_region::new_region(std::string name, virtual_clock::steady::duration /* tick_rate */) const
 {
@@ -38,6 +48,11 @@ pure::event_source<void>& parallel_region::switch_tick()
 	return ticks.switch_tick();
 }
 
+pure::event_source<void>& parallel_region::output_switch_tick()
+{
+	return ticks.output_switch_tick();
+}
+
 pure::event_source<void>& parallel_region::work_tick()
 {
 	return ticks.work_tick();
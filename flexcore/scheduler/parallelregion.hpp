@@ -10,6 +10,7 @@
 
 #include <flexcore/pure/event_sources.hpp>
 #include <flexcore/scheduler/clock.hpp>
+#include <atomic>
 #include <string>
 #include <memory>
 
@@ -25,6 +26,15 @@ struct region_id
 
 bool operator==(const region_id& lhs, const region_id& rhs);
 
+class parallel_region;
+
+/// dependency between two regions, consumer uses data which producer writes.
+struct region_dependency
+{
+	const parallel_region* producer;
+	const parallel_region* consumer;
+};
+
 /**
  * \brief class providing the interface to cyclic ticks for nodes.
  */
@@ -33,8 +43,18 @@ class tick_controller
 public:
 	tick_controller() = default;
 
-	/// sends void event on the switch tick of the surrounding region
+	/**
+	 * \brief sends void event on the switch tick of the surrounding region
+	 * Buffers from which the region reads data of other regions are switched on this tick.
+	 */
 	pure::event_source<void>& switch_tick() { return switch_buffers_; }
+	/**
+	 * \brief sends void event when the outputs of the surrounding region are switched.
+	 * Buffers into which the region writes data for other regions are switched on this tick.
+	 * Usually fired together with switch_tick,
+	 * with dependency ordered execution it is fired right after the work tick instead.
+	 */
+	pure::event_source<void>& output_switch_tick() { return switch_outputs_; }
 	/**
 	 * \brief  sends void event on the work tick of the surrounding region
 	 * connect nodes, that want to be triggered every cycle to this.
@@ -45,7 +65,15 @@ public:
 	 * \brief Buffers in region will be switched when method is called.
 	 * expects event with no payload (void).
 	 */
-	void switch_buffers() { return switch_buffers_.fire(); }
+	void switch_buffers()
+	{
+		switch_inputs();
+		switch_outputs();
+	}
+	/// fires switch_tick only, switches the buffers the region reads from.
+	void switch_inputs() { switch_buffers_.fire(); }
+	/// fires output_switch_tick only, switches the buffers the region writes to.
+	void switch_outputs() { switch_outputs_.fire(); }
 	/**
 	 * \brief work ticks in region will be fired when event is received.
 	 * connect to scheduler.
@@ -54,6 +82,7 @@ public:
 	auto in_work() { return [this](){ return work.fire(); };}
 
 	pure::event_source<void> switch_buffers_;
+	pure::event_source<void> switch_outputs_;
 	pure::event_source<void> work;
 };
 
@@ -73,13 +102,44 @@ public:
 
 	region_id get_id() const;
 	pure::event_source<void>& switch_tick();
+	pure::event_source<void>& output_switch_tick();
 	pure::event_source<void>& work_tick();
+
+	/**
+	 * \brief makes the region event driven or periodic again.
+	 *
+	 * The periodic task of an event driven region only executes the region
+	 * in ticks in which events from other regions are waiting in its incoming buffers,
+	 * in all other ticks neither switch tick nor work tick are fired.
+	 * Only the output switch tick is still fired in the tick after an execution,
+	 * to pass the outputs of the region on to other regions.
+	 * The tick rate of the task is the latency with which new events are picked up.
+	 * Regions are periodic by default.
+	 * \pre the scheduler executing this region is not running.
+	 */
+	void set_event_driven(bool event_driven) { event_driven_ = event_driven; }
+	bool event_driven() const { return event_driven_; }
+	/**
+	 * \brief flag raised by event buffers, when events for this region become available.
+	 * Shared with the buffers, as they might outlive the region.
+	 */
+	const std::shared_ptr<std::atomic<bool>>& pending_events() const { return pending_events_; }
+	/**
+	 * \brief checks and resets the flag of pending events.
+	 * \returns true if the region needs to be executed in the current tick.
+	 */
+	bool take_activation();
+
 	/// Create new region from existing one.
 	virtual std::shared_ptr<parallel_region> new_region(std::string name,
 	                                                    virtual_clock::steady::duration) const;
 
 	tick_controller ticks;
 	region_id id;
+
+private:
+	bool event_driven_ = false;
+	std::shared_ptr<std::atomic<bool>> pending_events_;
 };
 
 } /* namespace fc */
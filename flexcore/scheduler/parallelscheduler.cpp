@@ -1,5 +1,6 @@
 #include <flexcore/scheduler/parallelscheduler.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 
@@ -13,21 +14,37 @@ int parallel_scheduler::num_threads()
 }
 
 parallel_scheduler::parallel_scheduler() :
+		parallel_scheduler(thread_pool_config{})
+{
+}
+
+parallel_scheduler::parallel_scheduler(const thread_pool_config& config) :
 		thread_pool(),
 		do_work(false),
-		task_queue()
+		task_queue(),
+		nr_of_idle_threads(0)
 {
-	start();
+	start(config.resolved_nr_of_threads());
+	try
+	{
+		for (size_t i = 0; i != thread_pool.size(); ++i)
+			config.apply(thread_pool[i], i);
+	}
+	catch (...)
+	{
+		//destructor is not called if constructor throws, running threads need to be joined.
+		stop();
+		throw;
+	}
 }
 
-
-void parallel_scheduler::start() noexcept
+void parallel_scheduler::start(size_t nr_of_threads) noexcept
 {
 	do_work = true;
 
 	//fill thread_pool in body of constructor,
 	//since otherwise threads would need to be copied
-	for (int i = 0, e = num_threads(); i != e; ++i)
+	for (size_t i = 0; i != nr_of_threads; ++i)
 	{
 		thread_pool.push_back(std::thread(
 				//infinite task loop for every thread,
@@ -43,7 +60,11 @@ void parallel_scheduler::start() noexcept
 							// If do_work is false then exit loop. If task_queue is not empty, exit.
 							// Still need to check which condition is true after the while loop.
 							while (task_queue.empty() && do_work)
+							{
+								++nr_of_idle_threads;
 								thread_control.wait(lock);
+								--nr_of_idle_threads;
+							}
 
 							if (!do_work)
 								return;
@@ -53,7 +74,7 @@ void parallel_scheduler::start() noexcept
 							assert(do_work);
 							assert(!task_queue.empty());
 
-							task = task_queue.front();
+							task = std::move(task_queue.front());
 							task_queue.pop();
 						}
 						if (task)
@@ -106,6 +127,20 @@ void parallel_scheduler::add_task(task_t new_task)
 	assert(!thread_pool.empty()); //check invariant
 }
 
+void parallel_scheduler::add_tasks(std::vector<task_t>& new_tasks)
+{
+	size_t nr_to_wake = 0;
+	{
+		queue_lock lock(task_queue_mutex);
+		for (auto& task : new_tasks)
+			task_queue.push(std::move(task));
+		// busy threads take the remaining tasks, once they are done with their current one.
+		nr_to_wake = std::min(new_tasks.size(), nr_of_idle_threads);
+	}
+	for (size_t i = 0; i != nr_to_wake; ++i)
+		thread_control.notify_one();
+	assert(!thread_pool.empty()); //check invariant
+}
 
 } /* namespace thread */
 } /* namespace fc */
@@ -2,6 +2,7 @@
 #define SRC_SCHEDULER_PARALLELSCHEDULER_HPP_
 
 #include <flexcore/scheduler/scheduler.hpp>
+#include <flexcore/scheduler/threadconfig.hpp>
 
 #include <thread>
 #include <vector>
@@ -27,18 +28,28 @@ public:
 	static int num_threads();
 
 	parallel_scheduler();
+	/**
+	 * \brief creates thread pool with number, affinity and priority of threads given by config.
+	 * \throws std::system_error if the configuration cannot be applied to the threads.
+	 */
+	explicit parallel_scheduler(const thread_pool_config& config);
 	parallel_scheduler(const parallel_scheduler&) = delete;
 	~parallel_scheduler() override;
 
 	///adds a new task and notifies waiting threads.
 	void add_task(task_t new_task) override;
+	/**
+	 * \brief adds all tasks under a single lock.
+	 * Wakes one idle thread per task, but not more threads than are idle.
+	 */
+	void add_tasks(std::vector<task_t>& new_tasks) override;
 	/// stops the work loop of all threads
 	void stop() noexcept override;
 	size_t nr_of_waiting_tasks() const override;
 
 private:
 	/// startes the work loop of all threads
-	void start() noexcept;
+	void start(size_t nr_of_threads) noexcept;
 
 	std::vector<std::thread> thread_pool;
 	bool do_work; ///< flag indicates threads to keep working.
@@ -50,6 +61,8 @@ private:
 	typedef std::unique_lock<std::mutex> queue_lock;
 	///used to notify worker threads if new tasks are available
 	std::condition_variable thread_control;
+	/// number of threads waiting on thread_control, guarded by task_queue_mutex.
+	size_t nr_of_idle_threads;
 };
 
 } /* namespace thread */
@@ -1,7 +1,11 @@
 #ifndef SRC_THREADING_SCHEDULER_HPP_
 #define SRC_THREADING_SCHEDULER_HPP_
 
-#include <functional>
+#include <flexcore/core/small_function.hpp>
+#include <flexcore/scheduler/clock.hpp>
+
+#include <cstddef>
+#include <vector>
 
 namespace fc
 {
@@ -10,8 +14,51 @@ namespace thread
 class scheduler
 {
 public:
-	using task_t = std::function<void(void)>;
+	/// move-only task, tasks small enough for the inline buffer don't allocate.
+	using task_t = small_function<void(void)>;
 	virtual void add_task(task_t new_task) = 0;
+	/**
+	 * \brief adds all tasks in new_tasks at once.
+	 *
+	 * Schedulers can override this to take their locks and wake their workers
+	 * only once per batch instead of once per task.
+	 * The tasks are moved from, new_tasks keeps its size and capacity.
+	 */
+	virtual void add_tasks(std::vector<task_t>& new_tasks)
+	{
+		for (auto& task : new_tasks)
+			add_task(std::move(task));
+	}
+	/// point in time until which a task should be finished.
+	using deadline_t = wall_clock::steady::time_point;
+	/// marks tasks without preferred worker.
+	static constexpr size_t no_affinity = static_cast<size_t>(-1);
+	/**
+	 * \brief hints on how to execute a task, schedulers are free to ignore them.
+	 */
+	struct task_hints
+	{
+		/// point in time until which the task should be finished.
+		deadline_t deadline = deadline_t::max();
+		/**
+		 * \brief key of the worker the task prefers to run on.
+		 * Tasks with equal key share their data and should run on the same worker,
+		 * schedulers map keys to their workers modulo the number of workers.
+		 */
+		size_t affinity = no_affinity;
+	};
+	/**
+	 * \brief adds new_tasks, hints[i] are the hints for new_tasks[i].
+	 *
+	 * Schedulers which prioritize tasks or keep them on specific workers override this,
+	 * all others ignore the hints and behave as add_tasks.
+	 * \pre hints.size() == new_tasks.size()
+	 */
+	virtual void add_tasks_with_hints(std::vector<task_t>& new_tasks,
+			const std::vector<task_hints>& /*hints*/)
+	{
+		add_tasks(new_tasks);
+	}
 	virtual void stop() = 0;
 	virtual size_t nr_of_waiting_tasks() const = 0;
 	virtual ~scheduler() = default;
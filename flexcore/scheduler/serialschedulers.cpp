@@ -13,6 +13,15 @@ void blocking_scheduler::add_task(task_t new_task)
 	new_task();
 }
 
+void blocking_scheduler::add_tasks(std::vector<task_t>& new_tasks)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (stopped)
+		throw std::runtime_error{"attempting to add a task to stopped scheduler."};
+	for (auto& task : new_tasks)
+		task();
+}
+
 void blocking_scheduler::stop()
 {
 	std::lock_guard<std::mutex> lock(mutex);
@@ -13,6 +13,8 @@ class blocking_scheduler : public scheduler
 {
 public:
 	void add_task(task_t new_task) override;
+	/// executes all tasks in order while holding the lock only once.
+	void add_tasks(std::vector<task_t>& new_tasks) override;
 	void stop() override;
 	size_t nr_of_waiting_tasks() const override;
 	~blocking_scheduler() override;
@@ -0,0 +1,124 @@
+#include <flexcore/scheduler/taskstatistics.hpp>
+
+namespace fc
+{
+namespace thread
+{
+
+namespace
+{
+constexpr auto relaxed = std::memory_order_relaxed;
+
+int64_t to_ns(wall_clock::steady::duration d)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+
+task_statistics::duration from_ns(int64_t ns)
+{
+	return std::chrono::duration_cast<task_statistics::duration>(std::chrono::nanoseconds(ns));
+}
+
+/// only a single thread records, thus load and store are sufficient instead of a cas loop.
+void store_max(std::atomic<int64_t>& value, int64_t candidate)
+{
+	if (candidate > value.load(relaxed))
+		value.store(candidate, relaxed);
+}
+}
+
+constexpr size_t task_statistics::nr_of_buckets;
+
+size_t task_statistics::bucket(duration execution_time) noexcept
+{
+	auto us = std::chrono::duration_cast<std::chrono::microseconds>(execution_time).count();
+	size_t result = 0;
+	while (us > 1 && result + 1 != nr_of_buckets)
+	{
+		us >>= 1;
+		++result;
+	}
+	return result;
+}
+
+void task_statistics_collector::record_dispatch(time_point dispatch) noexcept
+{
+	dispatch_ns.store(to_ns(dispatch.time_since_epoch()), relaxed);
+}
+
+void task_statistics_collector::record_run(time_point start, time_point end) noexcept
+{
+	const auto execution_ns = to_ns(end - start);
+	const auto nr_of_runs = runs.load(relaxed);
+	last_ns.store(execution_ns, relaxed);
+	if (nr_of_runs == 0 || execution_ns < min_ns.load(relaxed))
+		min_ns.store(execution_ns, relaxed);
+	store_max(max_ns, execution_ns);
+	total_ns.fetch_add(execution_ns, relaxed);
+	histogram[task_statistics::bucket(end - start)].fetch_add(1, relaxed);
+
+	// tasks executed without dispatch by a scheduler have no queue wait.
+	const auto dispatched = dispatch_ns.exchange(0, relaxed);
+	if (dispatched != 0)
+	{
+		const auto wait_ns = to_ns(start.time_since_epoch()) - dispatched;
+		last_wait_ns.store(wait_ns, relaxed);
+		store_max(max_wait_ns, wait_ns);
+		total_wait_ns.fetch_add(wait_ns, relaxed);
+		waits.fetch_add(1, relaxed);
+	}
+	runs.store(nr_of_runs + 1, relaxed);
+}
+
+void task_statistics_collector::record_overrun() noexcept
+{
+	overruns.fetch_add(1, relaxed);
+}
+
+void task_statistics_collector::record_skipped_tick() noexcept
+{
+	skipped_ticks.fetch_add(1, relaxed);
+}
+
+void task_statistics_collector::record_queued_tick() noexcept
+{
+	queued_ticks.fetch_add(1, relaxed);
+}
+
+task_statistics task_statistics_collector::snapshot() const
+{
+	task_statistics result;
+	result.nr_of_runs = runs.load(relaxed);
+	result.last_execution = from_ns(last_ns.load(relaxed));
+	result.min_execution = from_ns(min_ns.load(relaxed));
+	result.max_execution = from_ns(max_ns.load(relaxed));
+	if (result.nr_of_runs != 0)
+		result.mean_execution = from_ns(total_ns.load(relaxed) / int64_t(result.nr_of_runs));
+
+	const auto nr_of_waits = waits.load(relaxed);
+	result.last_queue_wait = from_ns(last_wait_ns.load(relaxed));
+	result.max_queue_wait = from_ns(max_wait_ns.load(relaxed));
+	if (nr_of_waits != 0)
+		result.mean_queue_wait = from_ns(total_wait_ns.load(relaxed) / int64_t(nr_of_waits));
+
+	result.nr_of_overruns = overruns.load(relaxed);
+	result.nr_of_skipped_ticks = skipped_ticks.load(relaxed);
+	result.nr_of_queued_ticks = queued_ticks.load(relaxed);
+	for (size_t i = 0; i != histogram.size(); ++i)
+		result.histogram[i] = histogram[i].load(relaxed);
+	return result;
+}
+
+void task_statistics_collector::reset() noexcept
+{
+	for (auto* c : {&dispatch_ns, &last_ns, &min_ns, &max_ns, &total_ns,
+	                &last_wait_ns, &max_wait_ns, &total_wait_ns})
+		c->store(0, relaxed);
+	for (auto* c : {&runs, &waits, &overruns, &skipped_ticks, &queued_ticks})
+		c->store(0, relaxed);
+	for (auto& bucket : histogram)
+		bucket.store(0, relaxed);
+}
+
+} /* namespace thread */
+} /* namespace fc */
@@ -0,0 +1,108 @@
+#ifndef SRC_SCHEDULER_TASKSTATISTICS_HPP_
+#define SRC_SCHEDULER_TASKSTATISTICS_HPP_
+
+#include <flexcore/scheduler/clock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace fc
+{
+namespace thread
+{
+
+/**
+ * \brief timing statistics of a periodic task.
+ *
+ * All durations are measured with the wall clock.
+ * Queue wait is the time between handing the task to the scheduler and the start of its execution.
+ */
+struct task_statistics
+{
+	typedef wall_clock::steady::duration duration;
+	/// number of buckets of the histogram
+	static constexpr size_t nr_of_buckets = 32;
+
+	uint64_t nr_of_runs = 0;
+	duration last_execution = duration::zero();
+	duration min_execution = duration::zero();
+	duration max_execution = duration::zero();
+	duration mean_execution = duration::zero();
+
+	duration last_queue_wait = duration::zero();
+	duration max_queue_wait = duration::zero();
+	duration mean_queue_wait = duration::zero();
+
+	/// number of times the task has not been finished when it was due again.
+	uint64_t nr_of_overruns = 0;
+	/// number of executions dropped due to overruns.
+	uint64_t nr_of_skipped_ticks = 0;
+	/// number of executions delayed due to overruns.
+	uint64_t nr_of_queued_ticks = 0;
+
+	/**
+	 * \brief histogram of execution times with logarithmic buckets.
+	 * Bucket i counts executions which took [2^i, 2^(i+1)) microseconds,
+	 * bucket 0 also counts all executions shorter than a microsecond.
+	 */
+	std::array<uint64_t, nr_of_buckets> histogram{{}};
+
+	/// index of the histogram bucket for an execution which took execution_time.
+	static size_t bucket(duration execution_time) noexcept;
+};
+
+/**
+ * \brief collects task_statistics of a single periodic task.
+ *
+ * Recording is lock-free and only uses relaxed atomic operations.
+ * It expects a single recording thread at a time,
+ * which holds for periodic tasks, as a task is never executed concurrently with itself.
+ * Snapshots can be taken from any thread at any time,
+ * they are not guaranteed to be consistent with a single run.
+ */
+class task_statistics_collector
+{
+public:
+	typedef wall_clock::steady::time_point time_point;
+
+	/// records that the task has been handed to the scheduler at time dispatch.
+	void record_dispatch(time_point dispatch) noexcept;
+	/// records an execution of the task from start to end.
+	void record_run(time_point start, time_point end) noexcept;
+	/// records that the task was not done when it was due again.
+	void record_overrun() noexcept;
+	/// records that an execution has been dropped after an overrun.
+	void record_skipped_tick() noexcept;
+	/// records that an execution has been delayed after an overrun.
+	void record_queued_tick() noexcept;
+
+	task_statistics snapshot() const;
+	/// \pre the task is not running
+	void reset() noexcept;
+
+private:
+	typedef std::atomic<int64_t> ns_counter;
+	typedef std::atomic<uint64_t> counter;
+
+	/// time of last dispatch in nanoseconds since epoch of the wall clock, 0 if none.
+	ns_counter dispatch_ns{0};
+	counter runs{0};
+	ns_counter last_ns{0};
+	ns_counter min_ns{0};
+	ns_counter max_ns{0};
+	ns_counter total_ns{0};
+	counter waits{0};
+	ns_counter last_wait_ns{0};
+	ns_counter max_wait_ns{0};
+	ns_counter total_wait_ns{0};
+	counter overruns{0};
+	counter skipped_ticks{0};
+	counter queued_ticks{0};
+	std::array<counter, task_statistics::nr_of_buckets> histogram{{}};
+};
+
+} /* namespace thread */
+} /* namespace fc */
+
+#endif /* SRC_SCHEDULER_TASKSTATISTICS_HPP_ */
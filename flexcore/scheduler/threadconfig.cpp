@@ -0,0 +1,60 @@
+#include <flexcore/scheduler/threadconfig.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace fc
+{
+namespace thread
+{
+
+size_t thread_pool_config::resolved_nr_of_threads() const
+{
+	if (!cpu_affinity.empty() && nr_of_threads != 0 && cpu_affinity.size() != nr_of_threads)
+		throw std::invalid_argument{"number of cpu affinities doesn't match number of threads"};
+
+	if (nr_of_threads != 0)
+		return nr_of_threads;
+	if (!cpu_affinity.empty())
+		return cpu_affinity.size();
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void thread_pool_config::apply(std::thread& worker, size_t index) const
+{
+	assert(index < resolved_nr_of_threads());
+	const auto handle = worker.native_handle();
+
+	if (!cpu_affinity.empty())
+	{
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		for (int cpu : cpu_affinity[index])
+		{
+			if (cpu < 0 || cpu >= CPU_SETSIZE)
+				throw std::invalid_argument{"cpu index out of range: " + std::to_string(cpu)};
+			CPU_SET(cpu, &cpus);
+		}
+		if (int error = pthread_setaffinity_np(handle, sizeof(cpus), &cpus))
+			throw std::system_error{error, std::system_category(),
+			                        "setting cpu affinity of worker thread failed"};
+	}
+
+	if (fifo_priority != 0)
+	{
+		sched_param param{};
+		param.sched_priority = fifo_priority;
+		if (int error = pthread_setschedparam(handle, SCHED_FIFO, &param))
+			throw std::system_error{error, std::system_category(),
+			                        "setting SCHED_FIFO priority of worker thread failed"};
+	}
+}
+
+} /* namespace thread */
+} /* namespace fc */
@@ -0,0 +1,63 @@
+#ifndef SRC_SCHEDULER_THREADCONFIG_HPP_
+#define SRC_SCHEDULER_THREADCONFIG_HPP_
+
+#include <thread>
+#include <vector>
+
+namespace fc
+{
+namespace thread
+{
+
+/**
+ * \brief Configuration of the worker threads of a thread pool based scheduler.
+ *
+ * Default constructed it creates one unpinned worker per hardware thread,
+ * which run with the default scheduling policy of the process.
+ *
+ * example:
+ * \code{cpp}
+ * thread_pool_config config;
+ * config.nr_of_threads = 2;
+ * config.cpu_affinity = {{2}, {3}}; // pin first worker to cpu 2, second to cpu 3
+ * config.fifo_priority = 50;
+ * infrastructure infra{config};
+ * \endcode
+ */
+struct thread_pool_config
+{
+	/**
+	 * \brief number of worker threads.
+	 * 0 selects cpu_affinity.size() if affinities are given
+	 * and the number of hardware threads otherwise.
+	 */
+	size_t nr_of_threads = 0;
+	/**
+	 * \brief cpus each worker is allowed to run on, worker i is pinned to cpu_affinity[i].
+	 * Leave empty to not pin workers,
+	 * otherwise one entry per worker thread needs to be given.
+	 */
+	std::vector<std::vector<int>> cpu_affinity;
+	/// realtime priority of the workers with SCHED_FIFO, 0 keeps the default policy.
+	int fifo_priority = 0;
+
+	/**
+	 * \brief number of threads a pool with this configuration consists of.
+	 * \throws std::invalid_argument if the number of affinities doesn't match nr_of_threads.
+	 * \post result > 0
+	 */
+	size_t resolved_nr_of_threads() const;
+
+	/**
+	 * \brief applies affinity and priority to the worker thread with the given index.
+	 * \pre index < resolved_nr_of_threads()
+	 * \throws std::system_error if the operating system rejects the settings.
+	 * \throws std::invalid_argument if a cpu index is out of range.
+	 */
+	void apply(std::thread& worker, size_t index) const;
+};
+
+} /* namespace thread */
+} /* namespace fc */
+
+#endif /* SRC_SCHEDULER_THREADCONFIG_HPP_ */
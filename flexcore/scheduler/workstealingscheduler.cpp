@@ -0,0 +1,290 @@
+#include <flexcore/scheduler/workstealingscheduler.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+namespace fc
+{
+namespace thread
+{
+
+namespace
+{
+/// scheduler owning the current thread, nullptr if the thread is no worker thread.
+thread_local const work_stealing_scheduler* owning_scheduler = nullptr;
+/// index of the current thread in the pool of owning_scheduler.
+thread_local size_t worker_index = 0;
+}
+
+work_stealing_scheduler::work_stealing_scheduler() :
+		work_stealing_scheduler(thread_pool_config{})
+{
+}
+
+work_stealing_scheduler::work_stealing_scheduler(const thread_pool_config& config) :
+		queues(),
+		thread_pool()
+{
+	start(config.resolved_nr_of_threads());
+	try
+	{
+		for (size_t i = 0; i != thread_pool.size(); ++i)
+			config.apply(thread_pool[i], i);
+	}
+	catch (...)
+	{
+		//destructor is not called if constructor throws, running threads need to be joined.
+		stop();
+		throw;
+	}
+}
+
+void work_stealing_scheduler::start(size_t nr_of_threads) noexcept
+{
+	assert(nr_of_threads > 0);
+	do_work = true;
+
+	//all queues need to exist before the first worker starts stealing.
+	for (size_t i = 0; i != nr_of_threads; ++i)
+		queues.push_back(std::make_unique<worker_queue>());
+	queue_begin.resize(nr_of_threads + 1);
+	next_entry.resize(nr_of_threads + 1);
+
+	for (size_t i = 0; i != nr_of_threads; ++i)
+		thread_pool.push_back(std::thread([this, i] () { work_loop(i); }));
+
+	assert(!thread_pool.empty()); //check invariant
+	assert(thread_pool.size() == queues.size());
+}
+
+void work_stealing_scheduler::work_loop(size_t self)
+{
+	owning_scheduler = this;
+	worker_index = self;
+
+	while (do_work)
+	{
+		task_t task;
+		if (pop_local(self, task) || steal(self, task))
+		{
+			if (task)
+				task();
+			continue;
+		}
+
+		// No task found, sleep until there are new tasks or we are stopped.
+		// nr_of_sleepers is incremented before nr_of_tasks is checked
+		// and push checks nr_of_sleepers after nr_of_tasks has been incremented,
+		// thus at least one side sees the change of the other and no wake up is lost.
+		queue_lock lock(sleep_mutex);
+		++nr_of_sleepers;
+		wake_up.wait(lock, [this]
+				{
+					return !do_work || nr_of_tasks.load() != 0;
+				});
+		--nr_of_sleepers;
+
+		if (!do_work)
+			return;
+	}
+}
+
+bool work_stealing_scheduler::pop_local(size_t self, task_t& task)
+{
+	auto& queue = *queues[self];
+	queue_lock lock(queue.mutex);
+	if (queue.tasks.empty())
+		return false;
+
+	task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	--nr_of_tasks;
+	return true;
+}
+
+bool work_stealing_scheduler::steal(size_t self, task_t& task)
+{
+	const auto nr_of_queues = queues.size();
+	for (size_t offset = 1; offset != nr_of_queues; ++offset)
+	{
+		auto& victim = *queues[(self + offset) % nr_of_queues];
+		// don't wait for busy queues, their owner or another thief is working on them.
+		queue_lock lock(victim.mutex, std::try_to_lock);
+		if (!lock.owns_lock() || victim.tasks.empty())
+			continue;
+
+		task = std::move(victim.tasks.front());
+		victim.tasks.pop_front();
+		--nr_of_tasks;
+		return true;
+	}
+	return false;
+}
+
+void work_stealing_scheduler::push(size_t target, task_t task)
+{
+	assert(target < queues.size());
+	{
+		auto& queue = *queues[target];
+		queue_lock lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+		// increment while holding the lock, so a pop can never decrement first.
+		++nr_of_tasks;
+	}
+	wake_sleepers(1);
+}
+
+template <class iter>
+void work_stealing_scheduler::push_range(size_t target, iter first, iter last)
+{
+	assert(target < queues.size());
+	auto& queue = *queues[target];
+	queue_lock lock(queue.mutex);
+	const auto nr_of_new_tasks = std::distance(first, last);
+	// inserted in reverse, as the owner pops from the back,
+	// thus it executes the tasks in the order of the batch.
+	queue.tasks.insert(queue.tasks.end(),
+			std::make_move_iterator(std::make_reverse_iterator(last)),
+			std::make_move_iterator(std::make_reverse_iterator(first)));
+	// increment while holding the lock, so a pop can never decrement first.
+	nr_of_tasks += nr_of_new_tasks;
+}
+
+void work_stealing_scheduler::wake_sleepers(size_t nr_of_new_tasks)
+{
+	if (nr_of_new_tasks == 0 || nr_of_sleepers.load() == 0)
+		return;
+
+	// acquire lock to not notify between the check of the predicate and the wait.
+	{
+		queue_lock lock(sleep_mutex);
+	}
+	if (nr_of_new_tasks == 1)
+		wake_up.notify_one();
+	else
+		wake_up.notify_all();
+}
+
+void work_stealing_scheduler::add_task(task_t new_task)
+{
+	if (owning_scheduler == this)
+		push(worker_index, std::move(new_task));
+	else
+		push(next_queue++ % queues.size(), std::move(new_task));
+}
+
+void work_stealing_scheduler::add_tasks(std::vector<task_t>& new_tasks)
+{
+	if (owning_scheduler == this)
+	{
+		push_range(worker_index, new_tasks.begin(), new_tasks.end());
+	}
+	else
+	{
+		const auto nr_of_queues = queues.size();
+		// continue round robin as if the tasks were added one by one.
+		const auto first_queue = next_queue.fetch_add(new_tasks.size());
+		auto chunk_begin = new_tasks.begin();
+		for (size_t i = 0; i != nr_of_queues; ++i)
+		{
+			// spread the remainder over the first queues, to keep chunks balanced.
+			const auto chunk_size = new_tasks.size() / nr_of_queues
+					+ (i < new_tasks.size() % nr_of_queues ? 1 : 0);
+			if (chunk_size == 0)
+				break;
+			push_range((first_queue + i) % nr_of_queues, chunk_begin, chunk_begin + chunk_size);
+			chunk_begin += chunk_size;
+		}
+		assert(chunk_begin == new_tasks.end());
+	}
+	wake_sleepers(new_tasks.size());
+}
+
+size_t work_stealing_scheduler::target_queue(const task_hints& hints, size_t first, size_t i) const
+{
+	if (hints.affinity != no_affinity)
+		return hints.affinity % queues.size();
+	if (owning_scheduler == this)
+		return worker_index;
+	return (first + i) % queues.size();
+}
+
+void work_stealing_scheduler::add_tasks_with_hints(std::vector<task_t>& new_tasks,
+		const std::vector<task_hints>& hints)
+{
+	assert(hints.size() == new_tasks.size());
+	const auto nr_of_queues = queues.size();
+	const auto first_queue = next_queue.fetch_add(new_tasks.size());
+
+	// the scratch buffers are shared by all threads adding batches.
+	std::lock_guard<std::mutex> batch_lock(batch_mutex);
+	// sort the task indices by target queue in a single pass (counting sort),
+	// queue_begin[q] is the first entry of queue q in batch_order.
+	batch_targets.resize(new_tasks.size());
+	batch_order.resize(new_tasks.size());
+	std::fill(queue_begin.begin(), queue_begin.end(), 0);
+	for (size_t i = 0; i != new_tasks.size(); ++i)
+	{
+		batch_targets[i] = target_queue(hints[i], first_queue, i);
+		++queue_begin[batch_targets[i] + 1];
+	}
+	std::partial_sum(queue_begin.begin(), queue_begin.end(), queue_begin.begin());
+	std::copy(queue_begin.begin(), queue_begin.end(), next_entry.begin());
+	for (size_t i = 0; i != new_tasks.size(); ++i)
+		batch_order[next_entry[batch_targets[i]]++] = i;
+
+	// lock every queue once and move all tasks for it.
+	for (size_t target = 0; target != nr_of_queues; ++target)
+	{
+		const auto first = queue_begin[target];
+		const auto last = queue_begin[target + 1];
+		if (first == last)
+			continue;
+		auto& queue = *queues[target];
+		queue_lock lock(queue.mutex);
+		// pushed in reverse, as the owner pops from the back,
+		// thus it executes the tasks in the order of the batch.
+		for (auto entry = last; entry != first; --entry)
+			queue.tasks.push_back(std::move(new_tasks[batch_order[entry - 1]]));
+		// increment while holding the lock, so a pop can never decrement first.
+		nr_of_tasks += last - first;
+	}
+	wake_sleepers(new_tasks.size());
+}
+
+void work_stealing_scheduler::stop() noexcept
+{
+	//first stop the infinite loop in all threads
+	{
+		//Acquire lock first, to stop work loops to go to sleep while we set the flag.
+		queue_lock lock(sleep_mutex);
+		do_work = false;
+	}
+	wake_up.notify_all();
+	//then stop all calculations and join threads
+	for (auto& thread : thread_pool)
+	{
+		if (thread.joinable())
+		{
+			thread.join();
+		}
+	}
+	assert(!thread_pool.empty()); //check invariant
+}
+
+work_stealing_scheduler::~work_stealing_scheduler()
+{
+	//first stop all threads, destroying running threads is illegal
+	stop();
+}
+
+size_t work_stealing_scheduler::nr_of_waiting_tasks() const
+{
+	return nr_of_tasks.load();
+}
+
+} /* namespace thread */
+} /* namespace fc */
@@ -0,0 +1,139 @@
+#ifndef SRC_SCHEDULER_WORKSTEALINGSCHEDULER_HPP_
+#define SRC_SCHEDULER_WORKSTEALINGSCHEDULER_HPP_
+
+#include <flexcore/scheduler/scheduler.hpp>
+#include <flexcore/scheduler/threadconfig.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fc
+{
+namespace thread
+{
+
+/**
+ * \brief scheduler based on a threadpool with one task queue per worker thread.
+ *
+ * New tasks are distributed round robin to the queues of the workers,
+ * unless they have a worker affinity.
+ * Tasks added from within a worker thread are put into the queue of that worker.
+ * Each worker takes tasks from the back of its own queue and
+ * steals from the front of the queues of other workers once its own queue is empty.
+ * Thus workers only contend for a lock if they access the same queue,
+ * instead of all contending for a single queue as in parallel_scheduler.
+ *
+ * Can be used as a drop-in replacement for parallel_scheduler in cycle_control.
+ * cycle_control gives every periodic task a worker affinity,
+ * thus a region keeps its data in the cache of a single worker.
+ * On NUMA systems pin the workers with thread_pool_config::cpu_affinity,
+ * then the buffers of a region are allocated on the node of its worker by first touch.
+ *
+ * \invariant thread_pool.size() == queues.size()
+ * \invariant thread_pool.size() > 0
+ */
+class work_stealing_scheduler : public scheduler
+{
+public:
+	work_stealing_scheduler();
+	/**
+	 * \brief creates thread pool with number, affinity and priority of threads given by config.
+	 * \throws std::system_error if the configuration cannot be applied to the threads.
+	 */
+	explicit work_stealing_scheduler(const thread_pool_config& config);
+	work_stealing_scheduler(const work_stealing_scheduler&) = delete;
+	~work_stealing_scheduler() override;
+
+	/// adds a new task to the queue of one worker and wakes a sleeping worker if necessary.
+	void add_task(task_t new_task) override;
+	/**
+	 * \brief splits new_tasks into one contiguous chunk per queue
+	 * and locks every queue only once.
+	 * Tasks added from within a worker thread all go to the queue of that worker.
+	 * As in add_tasks_with_hints, the owner of a queue executes its chunk in batch order.
+	 */
+	void add_tasks(std::vector<task_t>& new_tasks) override;
+	/**
+	 * \brief puts every task with affinity into the queue of the worker given by its key.
+	 *
+	 * As workers take tasks from their own queue first and only steal when it is empty,
+	 * a periodic task stays on the same worker from tick to tick,
+	 * as long as this worker keeps up.
+	 * Tasks without affinity are distributed as by add_tasks.
+	 * Every queue is locked only once per batch.
+	 * The batch is sorted by queue in scratch buffers kept as members,
+	 * thus no memory is allocated once they have grown to the largest batch.
+	 * The tasks of a queue are inserted in reverse, so its owner, which takes tasks
+	 * from the back, executes them in the order of new_tasks,
+	 * e.g. the slow first order of cycle_control. Thieves take the last tasks first.
+	 * Deadlines are ignored.
+	 */
+	void add_tasks_with_hints(std::vector<task_t>& new_tasks,
+			const std::vector<task_hints>& hints) override;
+	/// stops the work loop of all threads
+	void stop() noexcept override;
+	size_t nr_of_waiting_tasks() const override;
+
+private:
+	/// task queue owned by a single worker thread.
+	struct worker_queue
+	{
+		std::mutex mutex;
+		std::deque<task_t> tasks;
+	};
+	typedef std::unique_lock<std::mutex> queue_lock;
+
+	/// starts the work loop of all threads
+	void start(size_t nr_of_threads) noexcept;
+	/// infinite work loop of the worker thread with index self
+	void work_loop(size_t self);
+	/// takes a task from the back of the queue of worker self
+	bool pop_local(size_t self, task_t& task);
+	/// takes a task from the front of the queue of any other worker than self
+	bool steal(size_t self, task_t& task);
+	/// puts task into the queue with index target and wakes a worker if any is sleeping
+	void push(size_t target, task_t task);
+	/**
+	 * \brief puts tasks [first, last) into the queue with index target without waking anyone.
+	 * The owner of the queue executes them in the order of the range.
+	 */
+	template <class iter>
+	void push_range(size_t target, iter first, iter last);
+	/// queue for task i of a batch, first is the round robin index of the batch.
+	size_t target_queue(const task_hints& hints, size_t first, size_t i) const;
+	/// wakes up to nr_of_new_tasks sleeping workers.
+	void wake_sleepers(size_t nr_of_new_tasks);
+
+	std::vector<std::unique_ptr<worker_queue>> queues;
+	std::vector<std::thread> thread_pool;
+	std::atomic<bool> do_work{false}; ///< flag indicates threads to keep working.
+	/// number of tasks which have been added but not yet been taken out of a queue.
+	std::atomic<size_t> nr_of_tasks{0};
+	/// index of the queue the next task from outside the pool is added to.
+	std::atomic<size_t> next_queue{0};
+
+	/// number of workers which are sleeping or about to sleep on wake_up.
+	std::atomic<size_t> nr_of_sleepers{0};
+	std::mutex sleep_mutex;
+	/// used to notify sleeping workers if new tasks are available
+	std::condition_variable wake_up;
+
+	/// guards the scratch buffers of add_tasks_with_hints, as batches may come from any thread.
+	std::mutex batch_mutex;
+	/// scratch storage for add_tasks_with_hints, kept as members to avoid allocations every tick
+	std::vector<size_t> batch_targets;
+	std::vector<size_t> batch_order;
+	/// one entry per queue and one past the end.
+	std::vector<size_t> queue_begin;
+	std::vector<size_t> next_entry;
+};
+
+} /* namespace thread */
+} /* namespace fc */
+
+#endif /* SRC_SCHEDULER_WORKSTEALINGSCHEDULER_HPP_ */
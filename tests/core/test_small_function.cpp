@@ -0,0 +1,82 @@
+#include <boost/test/unit_test.hpp>
+
+#include <flexcore/core/small_function.hpp>
+
+#include <array>
+#include <memory>
+
+using namespace fc;
+
+BOOST_AUTO_TEST_SUITE(test_small_function)
+
+namespace
+{
+/// counts the number of living instances to check destruction of stored callables.
+struct counted
+{
+	explicit counted(int& instances) : instances(&instances) { ++*this->instances; }
+	counted(const counted& other) noexcept : instances(other.instances) { ++*instances; }
+	~counted() { --*instances; }
+	int operator()(int x) const { return x + 1; }
+	int* instances;
+};
+}
+
+BOOST_AUTO_TEST_CASE(test_empty)
+{
+	small_function<void()> f;
+	BOOST_CHECK(!f);
+	BOOST_CHECK_THROW(f(), std::bad_function_call);
+
+	small_function<void()> from_null{std::function<void()>{}};
+	BOOST_CHECK(!from_null);
+}
+
+BOOST_AUTO_TEST_CASE(test_call_and_move)
+{
+	int value = 0;
+	small_function<void(int)> f{[&value](int x) { value = x; }};
+	BOOST_CHECK(f);
+	f(1);
+	BOOST_CHECK_EQUAL(value, 1);
+
+	auto g = std::move(f);
+	BOOST_CHECK(!f);
+	g(2);
+	BOOST_CHECK_EQUAL(value, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_move_only_callable)
+{
+	auto ptr = std::make_unique<int>(42);
+	small_function<int()> f{[p = std::move(ptr)] { return *p; }};
+	BOOST_CHECK_EQUAL(f(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(test_inline_and_heap_storage)
+{
+	int instances = 0;
+	using function_t = small_function<int(int)>;
+	static_assert(function_t::stored_inline<counted>(), "small callables are stored inline");
+	using large_t = std::array<char, 64>;
+	auto large = [data = large_t{}](int x) { return x + data[0]; };
+	static_assert(!function_t::stored_inline<decltype(large)>(), "large callables are not");
+
+	{
+		function_t f{counted{instances}};
+		BOOST_CHECK_EQUAL(instances, 1);
+		function_t g{std::move(f)};
+		BOOST_CHECK_EQUAL(instances, 1);
+		BOOST_CHECK_EQUAL(g(1), 2);
+		g = large;
+		BOOST_CHECK_EQUAL(instances, 0);
+		BOOST_CHECK_EQUAL(g(1), 1);
+		f = std::move(g);
+		BOOST_CHECK_EQUAL(f(2), 2);
+		f = nullptr;
+		BOOST_CHECK(!f);
+	}
+	BOOST_CHECK_EQUAL(instances, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
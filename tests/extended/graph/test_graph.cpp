@@ -80,4 +80,34 @@ BOOST_AUTO_TEST_CASE(test_graph_creation)
 	BOOST_CHECK_EQUAL(line_count, 10 + 8 + 2);
 }
 
+BOOST_AUTO_TEST_CASE(test_region_dependencies)
+{
+	graph::connection_graph graph;
+	auto region_1 = std::make_shared<parallel_region>("r1");
+	auto region_2 = std::make_shared<parallel_region>("r2");
+	auto region_3 = std::make_shared<parallel_region>("r3");
+	forest_owner forest{graph, "forest", region_1};
+	auto& r = forest.nodes();
+	dummy_node& first = r.make_child_named<dummy_node>(region_1, "first");
+	dummy_node& second = r.make_child_named<dummy_node>(region_2, "second");
+	dummy_node& third = r.make_child_named<dummy_node>(region_3, "third");
+	dummy_node& same_region = r.make_child_named<dummy_node>(region_3, "same region");
+
+	first.out() >> second.in();
+	second.out() >> graph::named([](int i){ return i; }, "between regions") >> third.in();
+	third.out() >> same_region.in();
+
+	const auto dependencies = graph.region_dependencies();
+	BOOST_REQUIRE_EQUAL(dependencies.size(), 2);
+	auto has_dependency = [&](auto& producer, auto& consumer)
+	{
+		return std::any_of(dependencies.begin(), dependencies.end(), [&](auto& d)
+				{
+					return d.producer == producer.get() && d.consumer == consumer.get();
+				});
+	};
+	BOOST_CHECK(has_dependency(region_1, region_2));
+	BOOST_CHECK(has_dependency(region_2, region_3));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,8 @@
 
 #include <flexcore/extended/base_node.hpp>
 #include <flexcore/infrastructure.hpp>
+#include <flexcore/scheduler/parallelscheduler.hpp>
+#include <flexcore/scheduler/workstealingscheduler.hpp>
 
 // std
 #include <memory>
@@ -33,4 +35,109 @@ BOOST_AUTO_TEST_CASE(test_buildup)
 	BOOST_CHECK_EQUAL(test_node.name(), "null");
 }
 
+BOOST_AUTO_TEST_CASE(test_custom_scheduler)
+{
+	thread::thread_pool_config config;
+	config.nr_of_threads = 2;
+	infrastructure test_is{std::make_unique<thread::work_stealing_scheduler>(config)};
+
+	std::atomic<bool> worked{false};
+	auto region = test_is.add_region("test_region", thread::cycle_control::fast_tick);
+	region->work_tick() >> [&worked] { worked = true; };
+	test_is.start_scheduler();
+	while (!worked)
+		std::this_thread::yield();
+	test_is.stop_scheduler();
+	BOOST_CHECK(worked);
+}
+
+BOOST_AUTO_TEST_CASE(test_independent_clocks)
+{
+	// two simulations run in parallel, each sees only the time of its own infrastructure.
+	const auto global_start = virtual_clock::steady::now();
+	auto simulate = [](int nr_of_ticks, virtual_clock::steady::duration& last_seen)
+	{
+		infrastructure test_is{std::make_unique<thread::parallel_scheduler>()};
+		auto& domain = test_is.use_own_clock_domain();
+		std::atomic<int> ticks{0};
+		auto region = test_is.add_region("simulation", thread::cycle_control::fast_tick);
+		region->work_tick() >> [&]
+		{
+			last_seen = virtual_clock::steady::now().time_since_epoch();
+			++ticks;
+		};
+		test_is.start_scheduler(true);
+		while (ticks.load() < nr_of_ticks)
+			std::this_thread::yield();
+		test_is.stop_scheduler();
+
+		virtual_clock::domain::scope scope{domain};
+		// last work tick has seen the time after the tick it ran in.
+		return last_seen <= virtual_clock::steady::now().time_since_epoch();
+	};
+
+	virtual_clock::steady::duration seen_1{}, seen_2{};
+	bool consistent_1 = false;
+	std::thread first{[&] { consistent_1 = simulate(50, seen_1); }};
+	const bool consistent_2 = simulate(100, seen_2);
+	first.join();
+
+	BOOST_CHECK(consistent_1);
+	BOOST_CHECK(consistent_2);
+	BOOST_CHECK(seen_1 >= thread::cycle_control::fast_tick * 50);
+	BOOST_CHECK(seen_2 >= thread::cycle_control::fast_tick * 100);
+	BOOST_CHECK(virtual_clock::steady::now() == global_start);
+}
+
+BOOST_AUTO_TEST_CASE(test_offload)
+{
+	infrastructure test_is{std::make_unique<thread::parallel_scheduler>()};
+	thread::thread_pool_config config;
+	config.nr_of_threads = 1;
+	auto& executor = test_is.use_offload_executor(config, 4);
+	BOOST_CHECK_EQUAL(&executor, &test_is.offload_executor());
+	BOOST_CHECK_THROW(test_is.use_offload_executor(config), std::runtime_error);
+
+	auto region = test_is.add_region("offloading", thread::cycle_control::fast_tick);
+	std::atomic<int> result{0};
+	bool offloaded = false;
+	region->work_tick() >> [&]
+	{
+		if (!offloaded)
+			offloaded = executor.offload(*region, [] { return 42; },
+					[&result](int value) { result = value; });
+	};
+	test_is.start_scheduler();
+	while (result.load() != 42)
+		std::this_thread::yield();
+	test_is.stop_scheduler();
+}
+
+BOOST_AUTO_TEST_CASE(test_offload_executor_created_while_running)
+{
+	infrastructure test_is{std::make_unique<thread::parallel_scheduler>()};
+	test_is.start_scheduler();
+	BOOST_CHECK_THROW(test_is.offload_executor(), std::runtime_error);
+	test_is.stop_scheduler();
+	auto& executor = test_is.offload_executor();
+	// regions created before the executor have been added as well.
+	BOOST_CHECK(executor.offload(*test_is.node_owner().region(), [] {}, [] {}));
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_length_not_dividing_medium_tick)
+{
+	using namespace std::chrono_literals;
+	// 100ms is no multiple of 3ms, the root region needs to use a multiple of the tick length.
+	infrastructure test_is{std::make_unique<thread::parallel_scheduler>(), 3ms};
+
+	std::atomic<bool> worked{false};
+	auto region = test_is.add_region("test_region", 3ms);
+	region->work_tick() >> [&worked] { worked = true; };
+	test_is.start_scheduler();
+	while (!worked)
+		std::this_thread::yield();
+	test_is.stop_scheduler();
+	BOOST_CHECK(worked);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
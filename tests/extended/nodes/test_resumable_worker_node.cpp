@@ -0,0 +1,70 @@
+#include <boost/test/unit_test.hpp>
+#include <flexcore/scheduler/parallelregion.hpp>
+#include <flexcore/extended/nodes/resumable_worker_node.hpp>
+#include "nodes/owning_node.hpp"
+
+#include <thread>
+
+using namespace fc;
+
+BOOST_AUTO_TEST_SUITE(test_resumable_worker)
+
+BOOST_AUTO_TEST_CASE(test_steps_spread_over_ticks)
+{
+	using namespace std::chrono_literals;
+	auto region = std::make_shared<parallel_region>("MyRegion");
+	tests::owning_node owner(region);
+	auto& worker = owner.make_child_named<resumable_worker_node>("Worker", 1ms);
+	int finished = 0;
+	worker.finished() >> [&finished] { ++finished; };
+
+	// every step exceeds the budget, thus one step is executed per tick.
+	int steps = 0;
+	worker.add_job([&steps](const work_budget&)
+	{
+		std::this_thread::sleep_for(2ms);
+		return ++steps == 3;
+	});
+	worker.add_job([](const work_budget&) { return true; });
+	BOOST_CHECK_EQUAL(worker.nr_of_jobs(), 2);
+
+	region->ticks.work.fire();
+	BOOST_CHECK_EQUAL(steps, 1);
+	region->ticks.work.fire();
+	BOOST_CHECK_EQUAL(steps, 2);
+	BOOST_CHECK_EQUAL(finished, 0);
+	region->ticks.work.fire();
+	BOOST_CHECK_EQUAL(steps, 3);
+	BOOST_CHECK_EQUAL(finished, 1);
+	region->ticks.work.fire();
+	BOOST_CHECK_EQUAL(finished, 2);
+	BOOST_CHECK_EQUAL(worker.nr_of_jobs(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_loop_job)
+{
+	using namespace std::chrono_literals;
+	auto region = std::make_shared<parallel_region>("MyRegion");
+	tests::owning_node owner(region);
+	auto& worker = owner.make_child_named<resumable_worker_node>("Worker", 1h);
+
+	std::vector<size_t> visited;
+	worker.add_job(make_loop_job(100, [&visited](size_t i) { visited.push_back(i); }));
+	// the budget suffices for the whole loop in a single tick.
+	region->ticks.work.fire();
+	BOOST_CHECK_EQUAL(visited.size(), 100);
+	BOOST_CHECK_EQUAL(visited.back(), 99);
+	BOOST_CHECK_EQUAL(worker.nr_of_jobs(), 0);
+
+	auto& slow_worker = owner.make_child_named<resumable_worker_node>("Slow", 0ms);
+	visited.clear();
+	slow_worker.add_job(make_loop_job(3, [&visited](size_t i) { visited.push_back(i); }));
+	for (int i = 0; i != 3; ++i)
+	{
+		region->ticks.work.fire();
+		BOOST_CHECK_EQUAL(visited.size(), i + 1);
+	}
+	BOOST_CHECK_EQUAL(slow_worker.nr_of_jobs(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
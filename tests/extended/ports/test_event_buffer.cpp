@@ -41,4 +41,79 @@ BOOST_AUTO_TEST_CASE(test_event_buffer)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(test_move_only_events)
+{
+	event_buffer<std::unique_ptr<int>> test_buffer;
+
+	std::vector<int> received;
+	pure::event_sink<std::unique_ptr<int>> sink(
+			[&](std::unique_ptr<int> in) { received.push_back(*in); });
+	pure::event_source<std::unique_ptr<int>> source;
+
+	source >> test_buffer.in();
+	test_buffer.out() >> sink;
+
+	source.fire(std::make_unique<int>(1));
+	test_buffer.switch_active_tick()();
+	// second event is appended to the first, as passive side has not read yet
+	source.fire(std::make_unique<int>(2));
+	test_buffer.switch_active_tick()();
+	test_buffer.switch_passive_tick()();
+	test_buffer.work_tick()();
+	BOOST_CHECK((received == std::vector<int>{1, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_delivery)
+{
+	event_buffer<int> test_buffer;
+
+	std::vector<std::vector<int>> batches;
+	pure::batch_event_sink<int> sink([&](pure::event_span<const int> events)
+			{
+				batches.emplace_back(events.begin(), events.end());
+			});
+	pure::event_source<int> source;
+
+	source >> test_buffer.in();
+	test_buffer.out() >> sink;
+
+	source.fire(1);
+	source.fire(2);
+	source.fire(3);
+	test_buffer.switch_active_tick()();
+	test_buffer.switch_passive_tick()();
+	test_buffer.work_tick()();
+	// an empty buffer sends no batch at all.
+	test_buffer.work_tick()();
+	BOOST_REQUIRE_EQUAL(batches.size(), 1);
+	BOOST_CHECK((batches[0] == std::vector<int>{1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_CASE(test_bool_events)
+{
+	// std::vector<bool> can not be viewed as event_span, events are sent one by one.
+	event_buffer<bool> test_buffer;
+
+	std::vector<bool> received;
+	pure::event_sink<bool> sink([&](bool in) { received.push_back(in); });
+	std::vector<size_t> batch_sizes;
+	pure::batch_event_sink<bool> batch_sink([&](pure::event_span<const bool> events)
+			{
+				batch_sizes.push_back(events.size());
+			});
+	pure::event_source<bool> source;
+
+	source >> test_buffer.in();
+	test_buffer.out() >> sink;
+	test_buffer.out() >> batch_sink;
+
+	source.fire(true);
+	source.fire(false);
+	test_buffer.switch_active_tick()();
+	test_buffer.switch_passive_tick()();
+	test_buffer.work_tick()();
+	BOOST_CHECK((received == std::vector<bool>{true, false}));
+	BOOST_CHECK((batch_sizes == std::vector<size_t>{1, 1}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
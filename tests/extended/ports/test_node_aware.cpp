@@ -338,4 +338,83 @@ BOOST_AUTO_TEST_CASE(test_state_same_region)
 	BOOST_CHECK_EQUAL(sink.get(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(test_broadcast_between_regions)
+{
+	typedef std::shared_ptr<const std::vector<int>> payload_t;
+	typedef node_aware<pure::event_sink<payload_t>> test_in_port;
+	typedef node_aware<pure::broadcast_event_source<std::vector<int>>> test_out_port;
+	auto region_1 = std::make_shared<parallel_region>("r1");
+	auto region_2 = std::make_shared<parallel_region>("r2");
+	tests::owning_node root_1(region_1);
+	tests::owning_node root_2(region_2);
+
+	std::vector<payload_t> received;
+	auto write_param = [&received](payload_t in) { received.push_back(in); };
+	test_in_port test_in_1(*(root_2.region()), write_param);
+	test_in_port test_in_2(*(root_2.region()), write_param);
+	test_out_port test_out(*(root_1.region()));
+	test_out >> test_in_1;
+	test_out >> test_in_2;
+
+	test_out.fire(std::vector<int>{1, 2, 3});
+	region_1->ticks.switch_buffers();
+	region_2->ticks.switch_buffers();
+	region_2->ticks.in_work()();
+
+	// buffers pass on the shared event, no sink gets a copy.
+	BOOST_REQUIRE_EQUAL(received.size(), 2);
+	BOOST_CHECK_EQUAL(received[0], received[1]);
+	BOOST_CHECK((*received[0] == std::vector<int>{1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_between_regions)
+{
+	typedef node_aware<pure::batch_event_sink<int>> test_in_port;
+	typedef node_aware<pure::event_source<int>> test_out_port;
+	auto region_1 = std::make_shared<parallel_region>("r1");
+	auto region_2 = std::make_shared<parallel_region>("r2");
+	tests::owning_node root_1(region_1);
+	tests::owning_node root_2(region_2);
+
+	std::vector<size_t> batch_sizes;
+	test_in_port test_in(*(root_2.region()),
+			[&batch_sizes](pure::event_span<const int> events)
+			{
+				batch_sizes.push_back(events.size());
+			});
+	test_out_port test_out(*(root_1.region()));
+	test_out >> test_in;
+
+	test_out.fire(1);
+	test_out.fire(2);
+	region_1->ticks.switch_buffers();
+	region_2->ticks.switch_buffers();
+	region_2->ticks.in_work()();
+
+	// all events buffered during a tick arrive in a single batch.
+	BOOST_CHECK((batch_sizes == std::vector<size_t>{2}));
+}
+
+BOOST_AUTO_TEST_CASE(test_bool_between_regions)
+{
+	auto region_1 = std::make_shared<parallel_region>("r1");
+	auto region_2 = std::make_shared<parallel_region>("r2");
+	tests::owning_node root_1(region_1);
+	tests::owning_node root_2(region_2);
+
+	std::vector<bool> received;
+	node_aware<pure::event_sink<bool>> test_in(*(root_2.region()),
+			[&received](bool in) { received.push_back(in); });
+	node_aware<pure::event_source<bool>> test_out(*(root_1.region()));
+	test_out >> test_in;
+
+	test_out.fire(true);
+	test_out.fire(false);
+	region_1->ticks.switch_buffers();
+	region_2->ticks.switch_buffers();
+	region_2->ticks.in_work()();
+
+	BOOST_CHECK((received == std::vector<bool>{true, false}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
 
 #include <flexcore/pure/event_sinks.hpp>
 #include <flexcore/pure/event_sources.hpp>
+#include <flexcore/pure/static_event_source.hpp>
 #include <flexcore/core/connection.hpp>
 
 using namespace fc;
@@ -412,4 +413,220 @@ BOOST_AUTO_TEST_CASE( type_changing_lambda_without_void )
 	BOOST_CHECK(called_1);
 	BOOST_CHECK(called_2);
 }
+BOOST_AUTO_TEST_CASE( inline_handler_storage )
+{
+	static_assert(is_active_source<pure::inline_event_source<int>>{},
+			"inline_event_source is an active source");
+
+	pure::inline_event_source<int> test_source;
+	pure::event_sink_value<int> value_sink;
+	int sum = 0;
+	test_source >> [](int i){ return i * 2; } >> value_sink;
+	test_source >> [&sum](int i){ sum += i; };
+
+	disconnecting_event_sink<int> sink1;
+	{
+		disconnecting_event_sink<int> sink2;
+		test_source >> sink1;
+		test_source >> sink2;
+		BOOST_CHECK_EQUAL(test_source.nr_connected_handlers(), 4);
+		test_source.fire(3);
+		BOOST_CHECK_EQUAL(*(value_sink.storage), 6);
+		BOOST_CHECK_EQUAL(sum, 3);
+		BOOST_CHECK_EQUAL(*(sink1.storage), 3);
+		BOOST_CHECK_EQUAL(*(sink2.storage), 3);
+	}
+	BOOST_CHECK_EQUAL(test_source.nr_connected_handlers(), 3);
+
+	// the remaining handlers are moved together with the source.
+	auto moved_source = std::move(test_source);
+	moved_source.fire(4);
+	BOOST_CHECK_EQUAL(*(value_sink.storage), 8);
+	BOOST_CHECK_EQUAL(sum, 7);
+	BOOST_CHECK_EQUAL(*(sink1.storage), 4);
+}
+
+BOOST_AUTO_TEST_CASE( inline_handler_storage_void )
+{
+	pure::inline_event_source<void> test_source;
+	int counter = 0;
+	pure::event_sink<void> sink([&counter](){ ++counter; });
+	test_source >> sink;
+	test_source >> [&counter](){ counter += 10; };
+	test_source.fire();
+	BOOST_CHECK_EQUAL(counter, 11);
+}
+
+namespace
+{
+/// counts how often it has been copied.
+struct copy_counter
+{
+	copy_counter() = default;
+	copy_counter(const copy_counter& other) : copies(other.copies + 1) {}
+	copy_counter(copy_counter&& other) = default;
+	copy_counter& operator=(const copy_counter&) = default;
+	copy_counter& operator=(copy_counter&&) = default;
+	int copies = 0;
+};
+}
+
+BOOST_AUTO_TEST_CASE( move_into_last_handler )
+{
+	pure::event_source<copy_counter> test_source;
+	std::vector<int> copies;
+	test_source >> [&copies](copy_counter c){ copies.push_back(c.copies); };
+	test_source >> [&copies](copy_counter c){ copies.push_back(c.copies); };
+	test_source >> [&copies](copy_counter c){ copies.push_back(c.copies); };
+
+	test_source.fire(copy_counter{});
+	BOOST_CHECK((copies == std::vector<int>{1, 1, 0}));
+
+	// lvalue events are not moved from, thus every handler gets a copy.
+	copies.clear();
+	copy_counter lvalue;
+	test_source.fire(lvalue);
+	BOOST_CHECK((copies == std::vector<int>{1, 1, 1}));
+}
+
+BOOST_AUTO_TEST_CASE( move_only_events )
+{
+	pure::event_source<std::unique_ptr<int>> test_source;
+	int received = 0;
+	pure::event_sink<std::unique_ptr<int>> sink(
+			[&received](std::unique_ptr<int> in){ received = *in; });
+	test_source >> [](std::unique_ptr<int> in){ ++*in; return in; } >> sink;
+
+	test_source.fire(std::make_unique<int>(41));
+	BOOST_CHECK_EQUAL(received, 42);
+}
+
+BOOST_AUTO_TEST_CASE( broadcast_events )
+{
+	static_assert(is_active_source<pure::broadcast_event_source<int>>{},
+			"broadcast_event_source is an active source");
+
+	typedef std::shared_ptr<const std::vector<int>> payload_t;
+	pure::broadcast_event_source<std::vector<int>> test_source;
+	std::vector<payload_t> received;
+	pure::event_sink<payload_t> sink([&received](payload_t in){ received.push_back(in); });
+	test_source >> sink;
+	test_source >> [&received](payload_t in){ received.push_back(in); };
+	size_t last_size = 0;
+	test_source >> [](payload_t in){ return in->size(); }
+			>> [&last_size](size_t size){ last_size = size; };
+
+	test_source.fire(std::vector<int>{1, 2, 3});
+	BOOST_REQUIRE_EQUAL(received.size(), 2);
+	// all sinks share the same buffer
+	BOOST_CHECK_EQUAL(received[0], received[1]);
+	BOOST_CHECK((*received[0] == std::vector<int>{1, 2, 3}));
+	BOOST_CHECK_EQUAL(last_size, 3);
+
+	const auto shared = std::make_shared<const std::vector<int>>(5, 0);
+	test_source.fire(shared);
+	BOOST_REQUIRE_EQUAL(received.size(), 4);
+	BOOST_CHECK_EQUAL(received[2], shared);
+	BOOST_CHECK_EQUAL(received[3], shared);
+	BOOST_CHECK_EQUAL(last_size, 5);
+}
+
+BOOST_AUTO_TEST_CASE( static_event_source )
+{
+	pure::event_sink_value<int> value_sink;
+	std::vector<int> order;
+	pure::event_sink<int> sink([&order](int i){ order.push_back(i); });
+
+	auto test_source = pure::static_event_source<int>{}
+			.connect([](int i){ return i + 1; } >> [](int i){ return i * 2; } >> value_sink)
+			.connect(sink)
+			.connect([&order](int i){ order.push_back(-i); });
+	static_assert(decltype(test_source)::nr_connected_handlers() == 3,
+			"static_event_source counts its connections at compile time");
+
+	test_source.fire(1);
+	BOOST_CHECK_EQUAL(*(value_sink.storage), 4);
+	BOOST_CHECK((order == std::vector<int>{1, -1}));
+
+	auto void_source = pure::static_event_source<void>{}.connect([&order](){ order.clear(); });
+	void_source.fire();
+	BOOST_CHECK(order.empty());
+
+	pure::static_event_source<int> unconnected;
+	unconnected.fire(1);
+}
+
+BOOST_AUTO_TEST_CASE( static_event_source_moves_into_last )
+{
+	std::vector<int> copies;
+	auto test_source = pure::static_event_source<copy_counter>{}
+			.connect([&copies](copy_counter c){ copies.push_back(c.copies); })
+			.connect([&copies](copy_counter c){ copies.push_back(c.copies); });
+
+	test_source.fire(copy_counter{});
+	BOOST_CHECK((copies == std::vector<int>{1, 0}));
+
+	auto move_only_source = pure::static_event_source<std::unique_ptr<int>>{}
+			.connect([&copies](std::unique_ptr<int> in){ copies.push_back(*in); });
+	move_only_source.fire(std::make_unique<int>(7));
+	BOOST_CHECK_EQUAL(copies.back(), 7);
+}
+
+BOOST_AUTO_TEST_CASE( batch_events )
+{
+	pure::event_source<int> test_source;
+	std::vector<size_t> batch_sizes;
+	int batch_sum = 0;
+	pure::batch_event_sink<int> batch_sink([&](pure::event_span<const int> events)
+			{
+				batch_sizes.push_back(events.size());
+				for (auto e : events)
+					batch_sum += e;
+			});
+	std::vector<int> single;
+	test_source >> batch_sink;
+	test_source >> [&single](int i){ single.push_back(i); };
+	BOOST_CHECK_EQUAL(test_source.nr_connected_handlers(), 2);
+
+	std::vector<int> events{1, 2, 3};
+	test_source.fire_batch(pure::event_span<const int>(events));
+	BOOST_CHECK((batch_sizes == std::vector<size_t>{3}));
+	BOOST_CHECK_EQUAL(batch_sum, 6);
+	// sinks for single events fall back to receiving the events one by one.
+	BOOST_CHECK((single == std::vector<int>{1, 2, 3}));
+
+	// single events are sent to batch sinks as batches of one.
+	test_source.fire(4);
+	BOOST_CHECK((batch_sizes == std::vector<size_t>{3, 1}));
+	BOOST_CHECK_EQUAL(batch_sum, 10);
+	BOOST_CHECK_EQUAL(single.back(), 4);
+}
+
+BOOST_AUTO_TEST_CASE( batch_events_disconnect )
+{
+	pure::event_source<int> test_source;
+	{
+		pure::batch_event_sink<int> batch_sink([](pure::event_span<const int>){});
+		test_source >> batch_sink;
+		BOOST_CHECK_EQUAL(test_source.nr_connected_handlers(), 1);
+	}
+	BOOST_CHECK_EQUAL(test_source.nr_connected_handlers(), 0);
+	test_source.fire(1);
+}
+
+BOOST_AUTO_TEST_CASE( batch_events_move_from_mutable_span )
+{
+	pure::event_source<copy_counter> test_source;
+	std::vector<int> copies;
+	test_source >> [&copies](copy_counter c){ copies.push_back(c.copies); };
+
+	std::vector<copy_counter> events(2);
+	test_source.fire_batch(pure::event_span<const copy_counter>(events));
+	BOOST_CHECK((copies == std::vector<int>{1, 1}));
+
+	copies.clear();
+	test_source.fire_batch(pure::event_span<copy_counter>(events));
+	BOOST_CHECK((copies == std::vector<int>{0, 0}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
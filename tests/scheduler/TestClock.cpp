@@ -5,6 +5,9 @@
 #include <flexcore/scheduler/clock.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <thread>
+#include <vector>
+
 
 using namespace fc;
 namespace chr = std::chrono;
@@ -88,4 +91,46 @@ BOOST_AUTO_TEST_CASE(test_time_t_conversion)
 			== chr::time_point_cast<chr::seconds>(back_converted));
 }
 
+BOOST_AUTO_TEST_CASE(test_concurrent_advance)
+{
+	// no advance may get lost, even if the clock is advanced from several threads.
+	const int nr_of_threads = 4;
+	const int advances_per_thread = 10000;
+	const auto start = virtual_clock::steady::now();
+	std::vector<std::thread> threads;
+	for (int i = 0; i != nr_of_threads; ++i)
+		threads.emplace_back([]
+		{
+			for (int j = 0; j != advances_per_thread; ++j)
+				master::advance();
+		});
+	for (auto& t : threads)
+		t.join();
+
+	BOOST_CHECK(virtual_clock::steady::now() - start
+			== one_tick * nr_of_threads * advances_per_thread);
+}
+
+BOOST_AUTO_TEST_CASE(test_clock_domains)
+{
+	const auto global_start = virtual_clock::steady::now();
+	virtual_clock::domain domain;
+	{
+		virtual_clock::domain::scope scope{domain};
+		BOOST_CHECK(&virtual_clock::domain::current() == &domain);
+		BOOST_CHECK(virtual_clock::steady::now().time_since_epoch() == chr::nanoseconds::zero());
+		master::advance();
+		BOOST_CHECK(virtual_clock::steady::now().time_since_epoch() == one_tick);
+	}
+	BOOST_CHECK(&virtual_clock::domain::current() == &virtual_clock::domain::global());
+	BOOST_CHECK(virtual_clock::steady::now() == global_start);
+
+	// other threads use the global domain
+	virtual_clock::domain::scope scope{domain};
+	virtual_clock::steady::time_point other_thread_time;
+	std::thread other{[&] { other_thread_time = virtual_clock::steady::now(); }};
+	other.join();
+	BOOST_CHECK(other_thread_time == global_start);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
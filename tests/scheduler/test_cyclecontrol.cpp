@@ -7,6 +7,9 @@
 
 #include <flexcore/scheduler/cyclecontrol.hpp>
 #include <flexcore/scheduler/parallelscheduler.hpp>
+#include <flexcore/scheduler/serialschedulers.hpp>
+#include <flexcore/extended/ports/node_aware.hpp>
+#include <flexcore/pure/pure_ports.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
 
@@ -15,6 +18,8 @@
 #include <iomanip>
 #include <ctime>
 #include <future>
+#include <thread>
+#include <numeric>
 #include <unistd.h>
 
 using namespace fc;
@@ -54,6 +59,32 @@ BOOST_AUTO_TEST_CASE( test_cyclecontrol_task_not_finished_in_time)
 	BOOST_CHECK(terminate_thread);
 }
 
+BOOST_AUTO_TEST_CASE(test_periodic_task_completion)
+{
+	using namespace std::chrono_literals;
+	std::atomic<bool> release{false};
+	thread::periodic_task task([&release]
+	{
+		while (!release.load())
+			std::this_thread::yield();
+	});
+	BOOST_CHECK(task.done());
+	BOOST_CHECK(task.wait_until_done(0ms));
+
+	task.set_work_to_do(true);
+	BOOST_CHECK(!task.done());
+	BOOST_CHECK(!task.wait_until_done(1ms));
+
+	std::thread worker{[&task] { task(); }};
+	bool waited = false;
+	std::thread waiter{[&task, &waited] { waited = task.wait_until_done(10s); }};
+	release.store(true);
+	waiter.join();
+	worker.join();
+	BOOST_CHECK(waited);
+	BOOST_CHECK(task.done());
+}
+
 BOOST_AUTO_TEST_CASE(test_adding_tasks_to_running_scheduler)
 {
 	namespace sched = fc::thread;
@@ -61,7 +92,21 @@ BOOST_AUTO_TEST_CASE(test_adding_tasks_to_running_scheduler)
 	controller.start();
 	BOOST_CHECK_THROW(controller.add_task({[]{}}, sched::cycle_control::fast_tick), std::runtime_error);
 	controller.stop();
-	BOOST_CHECK_THROW(controller.add_task({[]{}}, 2 * sched::cycle_control::slow_tick), std::invalid_argument);
+	BOOST_CHECK_NO_THROW(controller.add_task({[]{}}, 2 * sched::cycle_control::slow_tick));
+}
+
+BOOST_AUTO_TEST_CASE(test_unsupported_tick_rates)
+{
+	namespace sched = fc::thread;
+	using cycle = sched::cycle_control;
+	sched::cycle_control controller{std::make_unique<sched::parallel_scheduler>()};
+	BOOST_CHECK_THROW(controller.add_task({[]{}}, virtual_clock::duration::zero()),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(controller.add_task({[]{}}, -cycle::min_tick_length),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(controller.add_task({[]{}}, cycle::min_tick_length * 3 / 2),
+	                  std::invalid_argument);
+	BOOST_CHECK_NO_THROW(controller.add_task({[]{}}, cycle::min_tick_length * 7));
 }
 
 BOOST_AUTO_TEST_CASE(test_fast_main_loop)
@@ -96,4 +141,615 @@ BOOST_AUTO_TEST_CASE(test_fast_main_loop)
 	BOOST_TEST_MESSAGE("Medium count: " << count_medium);
 	BOOST_TEST_MESSAGE("Slow count: " << count_slow);
 }
+BOOST_AUTO_TEST_CASE(test_arbitrary_tick_rates)
+{
+	namespace sched = fc::thread;
+	using cycle = sched::cycle_control;
+	sched::cycle_control controller{std::make_unique<sched::parallel_scheduler>()};
+	auto count_1 = 0ull;
+	auto count_5 = 0ull;
+	auto count_25 = 0ull;
+	std::atomic_bool done{false};
+	controller.add_task({[&] { ++count_1; }}, cycle::min_tick_length);
+	controller.add_task({[&] { ++count_5; }}, cycle::min_tick_length * 5);
+	controller.add_task({[&] {
+		if (++count_25 == 20)
+			done.store(true);
+	}}, cycle::min_tick_length * 25);
+	controller.start(true);
+	while (!done.load())
+		std::this_thread::yield();
+	controller.stop();
+	BOOST_CHECK_CLOSE_FRACTION(static_cast<double>(count_1) / count_5, 5.0, 0.1);
+	BOOST_CHECK_CLOSE_FRACTION(static_cast<double>(count_5) / count_25, 5.0, 0.1);
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_length)
+{
+	namespace sched = fc::thread;
+	using namespace std::chrono_literals;
+	BOOST_CHECK_THROW(sched::cycle_control(std::make_unique<sched::blocking_scheduler>(), 0ms),
+	                  std::invalid_argument);
+
+	sched::cycle_control controller{std::make_unique<sched::blocking_scheduler>(), 1ms};
+	BOOST_CHECK(controller.tick_length() == 1ms);
+	auto count = 0;
+	controller.add_task({[&] { ++count; }}, 1ms);
+	BOOST_CHECK_THROW(controller.add_task({[]{}}, 1500us), std::invalid_argument);
+
+	const auto before = virtual_clock::steady::now();
+	for (int i = 0; i != 10; ++i)
+		controller.work();
+	BOOST_CHECK(virtual_clock::steady::now() - before == 10ms);
+	BOOST_CHECK_EQUAL(count, 10);
+}
+
+BOOST_AUTO_TEST_CASE(test_one_kilohertz)
+{
+	namespace sched = fc::thread;
+	using namespace std::chrono_literals;
+	sched::cycle_control controller{std::make_unique<sched::parallel_scheduler>(), 1ms};
+	std::vector<wall_clock::steady::time_point> starts;
+	starts.reserve(1000);
+	controller.add_task({[&]
+	{
+		if (starts.size() < starts.capacity())
+			starts.push_back(wall_clock::steady::now());
+	}}, 1ms);
+	controller.start();
+	std::this_thread::sleep_for(300ms);
+	controller.stop();
+
+	// allow for a slow test machine, but the loop has to cycle considerably faster than 100Hz.
+	BOOST_CHECK_GT(starts.size(), 150u);
+	BOOST_CHECK_LT(starts.size(), 400u);
+
+	std::vector<double> periods;
+	for (size_t i = 1; i < starts.size(); ++i)
+		periods.push_back(std::chrono::duration<double, std::micro>(
+				starts[i] - starts[i-1]).count());
+	const auto mean = std::accumulate(begin(periods), end(periods), 0.0) / periods.size();
+	const auto jitter = std::accumulate(begin(periods), end(periods), 0.0,
+			[mean](double acc, double p) { return std::max(acc, std::abs(p - mean)); });
+	BOOST_TEST_MESSAGE("1kHz ticks: " << starts.size() << " mean period: " << mean
+	                   << "us max jitter: " << jitter << "us");
+}
+
+BOOST_AUTO_TEST_CASE(test_absolute_deadlines)
+{
+	namespace sched = fc::thread;
+	using namespace std::chrono_literals;
+	for (auto spin_time : {wall_clock::steady::duration::zero(),
+	                       wall_clock::steady::duration(200us)})
+	{
+		sched::cycle_control controller{std::make_unique<sched::parallel_scheduler>(), 1ms};
+		sched::main_loop_timing timing;
+		timing.absolute_deadlines = true;
+		timing.spin_time = spin_time;
+		controller.set_main_loop_timing(timing);
+
+		std::vector<wall_clock::steady::time_point> starts;
+		starts.reserve(200);
+		controller.add_task({[&]
+		{
+			if (starts.size() < starts.capacity())
+				starts.push_back(wall_clock::steady::now());
+		}}, 1ms);
+		controller.start();
+		BOOST_CHECK_THROW(controller.set_main_loop_timing(timing), std::runtime_error);
+		std::this_thread::sleep_for(100ms);
+		controller.stop();
+		BOOST_REQUIRE_GT(starts.size(), 1u);
+
+		// without overruns every tick starts on the grid of deadlines, thus there is no drift.
+		const auto elapsed = starts.back() - starts.front();
+		const auto elapsed_ms = std::chrono::duration<double, std::milli>(elapsed).count();
+		BOOST_TEST_MESSAGE("overruns: " << controller.nr_of_overruns() << " elapsed: "
+		                   << elapsed_ms << "ms for " << starts.size() - 1 << " ticks");
+		if (controller.nr_of_overruns() == 0 && !controller.last_exception())
+		{
+			BOOST_CHECK(elapsed > (starts.size() - 2) * 1ms);
+			BOOST_CHECK(elapsed < starts.size() * 1ms);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_absolute_deadlines_keep_phase)
+{
+	using namespace std::chrono_literals;
+	const auto tick_length = wall_clock::steady::duration(10ms);
+	// work durations of a sequence of ticks, a single slow tick misses two deadlines.
+	const std::vector<wall_clock::steady::duration> work{1ms, 2ms, 25ms, 1ms, 10ms, 1ms};
+
+	for (bool absolute : {true, false})
+	{
+		thread::main_loop_timing timing;
+		timing.absolute_deadlines = absolute;
+		const wall_clock::steady::time_point start{};
+		std::vector<wall_clock::steady::time_point> starts{start};
+		auto deadline = start;
+		size_t missed = 0;
+		for (auto duration : work)
+		{
+			// the loop waits for the deadline, a late tick starts right away.
+			const auto tick_start = starts.back();
+			const auto next = timing.next(deadline, tick_start, tick_start + duration, tick_length);
+			missed += next.missed_deadlines;
+			deadline = next.deadline;
+			starts.push_back(std::max(deadline, tick_start + duration));
+		}
+
+		if (absolute) // ticks stay on the grid start + k * tick_length
+			BOOST_CHECK((starts == std::vector<wall_clock::steady::time_point>{start,
+					start + 10ms, start + 20ms, start + 50ms, start + 60ms, start + 70ms,
+					start + 80ms}));
+		else // the slow tick shifts all following ticks
+			BOOST_CHECK((starts == std::vector<wall_clock::steady::time_point>{start,
+					start + 10ms, start + 20ms, start + 45ms, start + 55ms, start + 65ms,
+					start + 75ms}));
+		// finishing exactly at the deadline is in time.
+		BOOST_CHECK_EQUAL(missed, absolute ? 2u : 1u);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_region_dependencies)
+{
+	// chain of regions r0 -> r1 -> r2, r1 forwards all events it receives.
+	for (bool ordered : {false, true})
+	{
+		auto r0 = std::make_shared<parallel_region>("r0");
+		auto r1 = std::make_shared<parallel_region>("r1");
+		auto r2 = std::make_shared<parallel_region>("r2");
+		node_aware<pure::event_source<int>> source{*r0};
+		node_aware<pure::event_source<int>> forward_out{*r1};
+		node_aware<pure::event_sink<int>> forward_in{*r1, [&](int i) { forward_out.fire(i); }};
+		int tick = 0;
+		// pairs of received value and tick of arrival.
+		std::vector<std::pair<int, int>> received;
+		node_aware<pure::event_sink<int>> sink{*r2, [&](int i) { received.emplace_back(i, tick); }};
+		source >> forward_in;
+		forward_out >> sink;
+		// fires the index of the current tick.
+		r0->work_tick() >> [&] { source.fire(tick); };
+
+		thread::cycle_control controller{std::make_unique<thread::blocking_scheduler>()};
+		if (ordered)
+		{
+			// add in reverse order, so that the order of adding doesn't resolve the chain.
+			for (auto& region : {r2, r1, r0})
+				controller.add_task(thread::periodic_task(region), thread::cycle_control::fast_tick);
+			controller.set_region_dependencies({{r0.get(), r1.get()}, {r1.get(), r2.get()}});
+		}
+		else
+		{
+			// without dependencies the switch ticks are fired in the order of adding.
+			for (auto& region : {r0, r1, r2})
+				controller.add_task(thread::periodic_task(region), thread::cycle_control::fast_tick);
+		}
+
+		for (; tick != 5; ++tick)
+			controller.work();
+		controller.stop();
+
+		if (ordered) // all events arrive in the tick they have been sent
+			BOOST_CHECK((received == std::vector<std::pair<int, int>>{
+					{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}}));
+		else // every region transition delays events by exactly one tick
+			BOOST_CHECK((received == std::vector<std::pair<int, int>>{
+					{0, 2}, {1, 3}, {2, 4}}));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_cyclic_region_dependencies)
+{
+	auto r0 = std::make_shared<parallel_region>("r0");
+	auto r1 = std::make_shared<parallel_region>("r1");
+	auto r2 = std::make_shared<parallel_region>("r2");
+	std::vector<std::string> order;
+	for (auto& region : {r0, r1, r2})
+		region->work_tick() >> [&order, region] { order.push_back(region->get_id().key); };
+
+	thread::cycle_control controller{std::make_unique<thread::blocking_scheduler>()};
+	for (auto& region : {r2, r1, r0})
+		controller.add_task(thread::periodic_task(region), thread::cycle_control::fast_tick);
+	// r0 and r1 form a cycle, r2 depends on it and thus runs in the final wave as well.
+	controller.set_region_dependencies(
+			{{r0.get(), r1.get()}, {r1.get(), r0.get()}, {r1.get(), r2.get()}});
+	controller.work();
+	controller.stop();
+
+	BOOST_CHECK_EQUAL(order.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_replay)
+{
+	using namespace std::chrono_literals;
+	using time_point = virtual_clock::system::time_point;
+	// recorded timestamps with irregular spacing
+	std::vector<time_point> timestamps;
+	for (int i = 0; i != 1000; ++i)
+		timestamps.push_back(time_point{24h + i * 10ms + (i % 3) * 1ms});
+
+	struct replay_result
+	{
+		std::vector<time_point> seen_times;
+		std::vector<int64_t> sums;
+	};
+	auto run_replay = [&timestamps]
+	{
+		replay_result result;
+		auto producer = std::make_shared<parallel_region>("producer");
+		auto consumer = std::make_shared<parallel_region>("consumer");
+		node_aware<pure::event_source<int64_t>> source{*producer};
+		int64_t sum = 0;
+		node_aware<pure::event_sink<int64_t>> sink{*consumer, [&sum](int64_t v) { sum += v; }};
+		source >> sink;
+		producer->work_tick() >> [&source]
+		{
+			source.fire(virtual_clock::system::now().time_since_epoch().count() % 1000003);
+		};
+		consumer->work_tick() >> [&]
+		{
+			result.seen_times.push_back(virtual_clock::system::now());
+			result.sums.push_back(sum);
+		};
+
+		thread::cycle_control controller{std::make_unique<thread::parallel_scheduler>()};
+		controller.add_task(thread::periodic_task(producer), thread::cycle_control::fast_tick);
+		controller.add_task(thread::periodic_task(consumer), thread::cycle_control::fast_tick);
+		controller.replay(timestamps.begin(), timestamps.end());
+		controller.stop();
+		return result;
+	};
+
+	const auto start = wall_clock::steady::now();
+	const auto first = run_replay();
+	const auto second = run_replay();
+	const auto elapsed = wall_clock::steady::now() - start;
+
+	BOOST_CHECK(first.seen_times == timestamps);
+	BOOST_CHECK(first.sums == second.sums);
+	BOOST_CHECK_NE(first.sums.back(), 0);
+	// 20 seconds of recorded ticks, replays don't wait for the wall clock.
+	BOOST_CHECK(elapsed < 10s);
+}
+
+BOOST_AUTO_TEST_CASE(test_task_statistics)
+{
+	using namespace std::chrono_literals;
+	auto region = std::make_shared<parallel_region>("measured");
+	region->work_tick() >> [] { std::this_thread::sleep_for(2ms); };
+	auto other = std::make_shared<parallel_region>("other");
+
+	// the blocking scheduler finishes each tick before work returns, thus there are no overruns.
+	thread::cycle_control controller{std::make_unique<thread::blocking_scheduler>()};
+	controller.add_task(thread::periodic_task(region), thread::cycle_control::fast_tick);
+	BOOST_CHECK_THROW(controller.statistics(*other), std::invalid_argument);
+
+	for (int i = 0; i != 5; ++i)
+		controller.work();
+	controller.stop();
+
+	const auto stats = controller.statistics(*region);
+	BOOST_CHECK_EQUAL(stats.nr_of_runs, 5);
+	BOOST_CHECK_EQUAL(stats.nr_of_overruns, 0);
+	BOOST_CHECK(stats.min_execution >= 2ms);
+	BOOST_CHECK(stats.min_execution <= stats.mean_execution);
+	BOOST_CHECK(stats.mean_execution <= stats.max_execution);
+	BOOST_CHECK(stats.max_queue_wait >= thread::task_statistics::duration::zero());
+	BOOST_CHECK_EQUAL(std::accumulate(stats.histogram.begin(), stats.histogram.end(), 0u), 5);
+
+	const auto all = controller.statistics();
+	BOOST_REQUIRE_EQUAL(all.size(), 1);
+	BOOST_CHECK(all.front().region == region.get());
+	BOOST_CHECK(all.front().tick_rate == thread::cycle_control::fast_tick);
+
+	controller.reset_statistics();
+	BOOST_CHECK_EQUAL(controller.statistics(*region).nr_of_runs, 0);
+}
+
+namespace
+{
+/// region whose work blocks until release is called.
+struct blocking_region
+{
+	explicit blocking_region(const std::string& name)
+		: region(std::make_shared<parallel_region>(name))
+	{
+		region->work_tick() >> [this]
+		{
+			++runs;
+			std::unique_lock<std::mutex> lock(mutex);
+			cv.wait(lock, [this] { return released; });
+			released = false;
+		};
+	}
+	void release()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			released = true;
+		}
+		cv.notify_all();
+	}
+
+	std::shared_ptr<parallel_region> region;
+	std::atomic<int> runs{0};
+	std::mutex mutex;
+	std::condition_variable cv;
+	bool released = false;
+};
+
+/// calls work until pred is true, fails after many ticks.
+template <class predicate>
+void work_until(thread::cycle_control& controller, predicate pred)
+{
+	for (int i = 0; i != 10000 && !pred(); ++i)
+	{
+		controller.work();
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+	BOOST_REQUIRE(pred());
+}
+
+/// scheduler with a second worker, which keeps running while the first one is blocked.
+std::unique_ptr<thread::scheduler> two_worker_scheduler()
+{
+	thread::thread_pool_config config;
+	config.nr_of_threads = 2;
+	return std::make_unique<thread::parallel_scheduler>(config);
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_overrun_skip_tick)
+{
+	blocking_region slow{"slow"};
+	auto fast = std::make_shared<parallel_region>("fast");
+	std::atomic<int> fast_runs{0};
+	fast->work_tick() >> [&fast_runs] { ++fast_runs; };
+
+	thread::cycle_control controller{two_worker_scheduler()};
+	controller.add_task(thread::periodic_task(slow.region), thread::cycle_control::fast_tick);
+	controller.add_task(thread::periodic_task(fast), thread::cycle_control::fast_tick);
+	controller.set_overrun_policy(*slow.region, thread::overrun_policy::skip_tick);
+	BOOST_CHECK_THROW(controller.set_overrun_policy(parallel_region{"other"},
+			thread::overrun_policy::skip_tick), std::invalid_argument);
+
+	// the slow region blocks, while the fast region keeps running.
+	work_until(controller, [&] { return fast_runs.load() >= 5; });
+	BOOST_CHECK(!controller.last_exception());
+	BOOST_CHECK_EQUAL(slow.runs.load(), 1);
+
+	slow.release();
+	work_until(controller, [&] { return slow.runs.load() == 2; });
+	slow.release();
+	controller.stop();
+
+	const auto stats = controller.statistics(*slow.region);
+	BOOST_CHECK(stats.nr_of_overruns >= 4);
+	BOOST_CHECK_EQUAL(stats.nr_of_skipped_ticks, stats.nr_of_overruns);
+	BOOST_CHECK_EQUAL(stats.nr_of_queued_ticks, 0);
+	BOOST_CHECK_EQUAL(controller.statistics(*fast).nr_of_overruns, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_overrun_queue_one)
+{
+	blocking_region slow{"slow"};
+	thread::cycle_control controller{two_worker_scheduler()};
+	auto task = thread::periodic_task(slow.region);
+	task.set_overrun_policy(thread::overrun_policy::queue_one);
+	controller.add_task(std::move(task), thread::cycle_control::fast_tick);
+
+	// only the first overrun is queued, all others are dropped.
+	work_until(controller, [&]
+	{
+		return controller.statistics(*slow.region).nr_of_overruns >= 3;
+	});
+	slow.release();
+	// the queued execution is dispatched as soon as the first one is done.
+	work_until(controller, [&] { return slow.runs.load() == 2; });
+	slow.release();
+	controller.stop();
+
+	const auto stats = controller.statistics(*slow.region);
+	BOOST_CHECK(!controller.last_exception());
+	BOOST_CHECK_EQUAL(stats.nr_of_queued_ticks, 1);
+	BOOST_CHECK_EQUAL(stats.nr_of_skipped_ticks + 1, stats.nr_of_overruns);
+}
+
+BOOST_AUTO_TEST_CASE(test_region_dependencies_late_producer)
+{
+	for (auto policy : {thread::overrun_policy::skip_tick, thread::overrun_policy::queue_one})
+	{
+		blocking_region producer{"producer"};
+		auto consumer = std::make_shared<parallel_region>("consumer");
+		node_aware<pure::event_source<int>> source{*producer.region};
+		std::atomic<int> received{0};
+		node_aware<pure::event_sink<int>> sink{*consumer, [&received](int) { ++received; }};
+		source >> sink;
+		producer.region->work_tick() >> [&source] { source.fire(0); };
+		std::atomic<int> consumer_runs{0};
+		consumer->work_tick() >> [&consumer_runs] { ++consumer_runs; };
+
+		thread::cycle_control controller{two_worker_scheduler()};
+		controller.add_task(thread::periodic_task(producer.region), thread::cycle_control::fast_tick);
+		controller.add_task(thread::periodic_task(consumer), thread::cycle_control::fast_tick);
+		controller.set_overrun_policy(*producer.region, policy);
+		controller.set_region_dependencies({{producer.region.get(), consumer.get()}});
+
+		// the consumer is neither switched nor executed, while its producer is running.
+		work_until(controller, [&]
+		{
+			return controller.statistics(*producer.region).nr_of_overruns >= 3;
+		});
+		BOOST_CHECK_EQUAL(consumer_runs.load(), 0);
+		BOOST_CHECK(controller.statistics(*consumer).nr_of_skipped_ticks >= 3);
+
+		// the consumer continues to receive events once the producer keeps up again.
+		work_until(controller, [&]
+		{
+			producer.release();
+			return received.load() >= 2;
+		});
+		producer.release();
+		controller.stop();
+		BOOST_CHECK(!controller.last_exception());
+		BOOST_CHECK_EQUAL(controller.statistics(*consumer).nr_of_overruns, 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_region_dependencies_slow_producer)
+{
+	using namespace std::chrono_literals;
+	// a slow producer feeds a slow and a fast consumer.
+	blocking_region producer{"producer"};
+	auto slow = std::make_shared<parallel_region>("slow");
+	auto fast = std::make_shared<parallel_region>("fast");
+	std::atomic<int> slow_runs{0};
+	std::atomic<int> fast_runs{0};
+	slow->work_tick() >> [&slow_runs] { ++slow_runs; };
+	fast->work_tick() >> [&fast_runs] { ++fast_runs; };
+
+	thread::cycle_control controller{two_worker_scheduler()};
+	const auto slow_rate = 10 * thread::cycle_control::fast_tick;
+	controller.add_task(thread::periodic_task(producer.region), slow_rate);
+	controller.add_task(thread::periodic_task(slow), slow_rate);
+	controller.add_task(thread::periodic_task(fast), thread::cycle_control::fast_tick);
+	controller.set_region_dependencies(
+			{{producer.region.get(), slow.get()}, {producer.region.get(), fast.get()}});
+	controller.set_clock_domain(std::make_shared<virtual_clock::domain>());
+
+	// the main loop neither waits for the slow producer nor stalls the fast consumer.
+	const auto start = wall_clock::steady::now();
+	for (int i = 0; i != 5; ++i)
+	{
+		controller.work();
+		std::this_thread::sleep_for(1ms);
+	}
+	BOOST_CHECK(wall_clock::steady::now() - start < slow_rate);
+	work_until(controller, [&] { return fast_runs.load() >= 5; });
+	BOOST_CHECK_EQUAL(slow_runs.load(), 0);
+
+	// the slow consumer runs as soon as its producer is done, within the same period.
+	producer.release();
+	work_until(controller, [&] { return slow_runs.load() == 1; });
+	controller.stop();
+
+	BOOST_CHECK(!controller.last_exception());
+	BOOST_CHECK_EQUAL(controller.statistics(*slow).nr_of_skipped_ticks, 0);
+	BOOST_CHECK_EQUAL(controller.statistics(*fast).nr_of_skipped_ticks, 0);
+	BOOST_CHECK_EQUAL(controller.statistics(*fast).nr_of_overruns, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_event_driven_region)
+{
+	auto producer = std::make_shared<parallel_region>("producer");
+	auto consumer = std::make_shared<parallel_region>("consumer");
+	consumer->set_event_driven(true);
+	node_aware<pure::event_source<int>> source{*producer};
+	std::vector<int> received;
+	node_aware<pure::event_sink<int>> sink{*consumer, [&received](int v) { received.push_back(v); }};
+	source >> sink;
+
+	int tick = 0;
+	producer->work_tick() >> [&]
+	{
+		if (tick % 5 == 0)
+			source.fire(tick);
+		++tick;
+	};
+	int consumer_runs = 0;
+	consumer->work_tick() >> [&consumer_runs] { ++consumer_runs; };
+
+	thread::cycle_control controller{std::make_unique<thread::blocking_scheduler>()};
+	controller.add_task(thread::periodic_task(producer), thread::cycle_control::fast_tick);
+	controller.add_task(thread::periodic_task(consumer), thread::cycle_control::fast_tick);
+	for (int i = 0; i != 10; ++i)
+		controller.work();
+	controller.stop();
+
+	// events fired in tick 0 and 5 are delivered in the following ticks.
+	BOOST_CHECK((received == std::vector<int>{0, 5}));
+	BOOST_CHECK_EQUAL(consumer_runs, 2);
+	BOOST_CHECK_EQUAL(controller.statistics(*consumer).nr_of_runs, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_event_driven_region_outputs)
+{
+	// chain producer -> forward -> consumer, only forward is event driven.
+	auto producer = std::make_shared<parallel_region>("producer");
+	auto forward = std::make_shared<parallel_region>("forward");
+	auto consumer = std::make_shared<parallel_region>("consumer");
+	forward->set_event_driven(true);
+	node_aware<pure::event_source<int>> source{*producer};
+	node_aware<pure::event_source<int>> forward_out{*forward};
+	node_aware<pure::event_sink<int>> forward_in{*forward, [&](int i) { forward_out.fire(i); }};
+	std::vector<int> received;
+	node_aware<pure::event_sink<int>> sink{*consumer, [&received](int v) { received.push_back(v); }};
+	source >> forward_in;
+	forward_out >> sink;
+
+	int tick = 0;
+	producer->work_tick() >> [&]
+	{
+		if (tick % 5 == 0)
+			source.fire(tick);
+		++tick;
+	};
+
+	thread::cycle_control controller{std::make_unique<thread::blocking_scheduler>()};
+	for (auto& region : {producer, forward, consumer})
+		controller.add_task(thread::periodic_task(region), thread::cycle_control::fast_tick);
+	for (int i = 0; i != 20; ++i)
+		controller.work();
+	controller.stop();
+
+	// outputs of the event driven region are switched in the tick after it ran,
+	// even though it is not activated in that tick.
+	BOOST_CHECK((received == std::vector<int>{0, 5, 10, 15}));
+	BOOST_CHECK_EQUAL(controller.statistics(*forward).nr_of_runs, 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_schedule_table)
+{
+	// rates of 2, 3 and 4 ticks have a hyperperiod of 12 ticks,
+	// rates of 257 and 263 ticks exceed the limit of the schedule table.
+	for (auto rates : {std::vector<int>{2, 3, 4}, std::vector<int>{257, 263, 2}})
+	{
+		thread::cycle_control controller{std::make_unique<thread::blocking_scheduler>()};
+		std::vector<std::vector<int>> run_ticks(rates.size());
+		int tick = 0;
+		for (size_t i = 0; i != rates.size(); ++i)
+			controller.add_task(thread::periodic_task([&run_ticks, &tick, i]
+					{
+						run_ticks[i].push_back(tick);
+					}),
+					rates[i] * thread::cycle_control::fast_tick);
+
+		// a new clock domain starts at tick zero, which is a multiple of all rates.
+		controller.set_clock_domain(std::make_shared<virtual_clock::domain>());
+		for (; tick != 600; ++tick)
+			controller.work();
+		controller.stop();
+
+		for (size_t i = 0; i != rates.size(); ++i)
+		{
+			BOOST_CHECK_EQUAL(run_ticks[i].size(), (600 + rates[i] - 1) / rates[i]);
+			for (size_t run = 0; run != run_ticks[i].size(); ++run)
+				BOOST_CHECK_EQUAL(run_ticks[i][run], int(run) * rates[i]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_statistics_histogram_buckets)
+{
+	using namespace std::chrono_literals;
+	using thread::task_statistics;
+	BOOST_CHECK_EQUAL(task_statistics::bucket(0ns), 0);
+	BOOST_CHECK_EQUAL(task_statistics::bucket(1500ns), 0);
+	BOOST_CHECK_EQUAL(task_statistics::bucket(2us), 1);
+	BOOST_CHECK_EQUAL(task_statistics::bucket(1ms), 9);
+	BOOST_CHECK_EQUAL(task_statistics::bucket(10000h), task_statistics::nr_of_buckets - 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
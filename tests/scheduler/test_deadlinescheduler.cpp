@@ -0,0 +1,129 @@
+#include <flexcore/scheduler/cyclecontrol.hpp>
+#include <flexcore/scheduler/deadlinescheduler.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <future>
+#include <numeric>
+#include <mutex>
+#include <thread>
+
+using namespace fc;
+
+BOOST_AUTO_TEST_SUITE(test_deadlinescheduler)
+
+namespace
+{
+/// single threaded scheduler, whose worker is blocked until release is called.
+struct blocked_scheduler
+{
+	blocked_scheduler()
+		: scheduler(single_thread())
+	{
+		auto blocked = release_worker.get_future().share();
+		scheduler.add_task([blocked] { blocked.wait(); });
+		// wait until the worker has taken the blocking task.
+		while (scheduler.nr_of_waiting_tasks() != 0)
+			std::this_thread::yield();
+	}
+	static thread::thread_pool_config single_thread()
+	{
+		thread::thread_pool_config config;
+		config.nr_of_threads = 1;
+		return config;
+	}
+	void release() { release_worker.set_value(); }
+	void wait_for(size_t nr_of_tasks)
+	{
+		while (true)
+		{
+			{
+				std::lock_guard<std::mutex> lock(order_mutex);
+				if (order.size() == nr_of_tasks)
+					return;
+			}
+			std::this_thread::yield();
+		}
+	}
+	thread::scheduler::task_t record(int id)
+	{
+		return [this, id]
+		{
+			std::lock_guard<std::mutex> lock(order_mutex);
+			order.push_back(id);
+		};
+	}
+
+	std::promise<void> release_worker;
+	std::mutex order_mutex;
+	std::vector<int> order;
+	thread::deadline_scheduler scheduler;
+};
+
+thread::scheduler::task_hints hints(thread::scheduler::deadline_t deadline)
+{
+	thread::scheduler::task_hints result;
+	result.deadline = deadline;
+	return result;
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_earliest_deadline_first)
+{
+	using namespace std::chrono_literals;
+	blocked_scheduler test;
+	const auto now = wall_clock::steady::now();
+
+	std::vector<thread::scheduler::task_t> slow;
+	slow.push_back(test.record(3));
+	test.scheduler.add_tasks_with_hints(slow, {hints(now + 1s)});
+	test.scheduler.add_task(test.record(4));
+	std::vector<thread::scheduler::task_t> fast;
+	fast.push_back(test.record(1));
+	fast.push_back(test.record(2));
+	test.scheduler.add_tasks_with_hints(fast, {hints(now + 10ms), hints(now + 10ms)});
+	BOOST_CHECK_EQUAL(test.scheduler.nr_of_waiting_tasks(), 4);
+
+	test.release();
+	test.wait_for(4);
+	BOOST_CHECK((test.order == std::vector<int>{1, 2, 3, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(test_fifo_without_deadlines)
+{
+	blocked_scheduler test;
+	std::vector<thread::scheduler::task_t> tasks;
+	for (int i = 0; i != 10; ++i)
+		tasks.push_back(test.record(i));
+	test.scheduler.add_tasks(tasks);
+
+	test.release();
+	test.wait_for(10);
+	std::vector<int> expected(10);
+	std::iota(expected.begin(), expected.end(), 0);
+	BOOST_CHECK(test.order == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_cycle_control)
+{
+	std::atomic<int> fast_runs{0};
+	std::atomic<int> slow_runs{0};
+	thread::cycle_control controller{std::make_unique<thread::deadline_scheduler>()};
+	controller.add_task(thread::periodic_task([&fast_runs] { ++fast_runs; }),
+			thread::cycle_control::fast_tick);
+	controller.add_task(thread::periodic_task([&slow_runs] { ++slow_runs; }),
+			thread::cycle_control::medium_tick);
+
+	for (int i = 0; i != 10; ++i)
+	{
+		controller.work();
+		while (controller.nr_of_tasks() != 0)
+			std::this_thread::yield();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	controller.stop();
+	BOOST_CHECK_EQUAL(fast_runs.load(), 10);
+	BOOST_CHECK_EQUAL(slow_runs.load(), 1);
+	BOOST_CHECK(!controller.last_exception());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,152 @@
+#include <flexcore/scheduler/offloadexecutor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <future>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+using namespace fc;
+
+BOOST_AUTO_TEST_SUITE(test_offloadexecutor)
+
+namespace
+{
+thread::thread_pool_config single_thread()
+{
+	thread::thread_pool_config config;
+	config.nr_of_threads = 1;
+	return config;
+}
+
+/// fires switch ticks of region until pred is true.
+template <class predicate>
+void tick_until(parallel_region& region, predicate pred)
+{
+	const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (!pred() && std::chrono::steady_clock::now() < timeout)
+	{
+		region.ticks.switch_buffers();
+		std::this_thread::yield();
+	}
+	BOOST_REQUIRE(pred());
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_completion_on_switch_tick)
+{
+	parallel_region region{"region"};
+	thread::offload_executor executor{single_thread()};
+	executor.add_region(region);
+	std::promise<void> work_done;
+	auto done = work_done.get_future();
+	int result = 0;
+	BOOST_CHECK(executor.offload(region,
+			[&work_done] { work_done.set_value(); return 42; },
+			[&result](int value) { result = value; }));
+
+	// the completion is not executed before the next switch tick of the region.
+	done.wait();
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	BOOST_CHECK_EQUAL(result, 0);
+	BOOST_CHECK(region.pending_events()->load());
+	tick_until(region, [&result] { return result == 42; });
+}
+
+BOOST_AUTO_TEST_CASE(test_void_and_move_only_results)
+{
+	parallel_region region{"region"};
+	thread::offload_executor executor{single_thread()};
+	executor.add_region(region);
+	bool void_done = false;
+	executor.offload(region, [] {}, [&void_done] { void_done = true; });
+	int value = 0;
+	executor.offload(region,
+			[] { return std::make_unique<int>(7); },
+			[&value](std::unique_ptr<int> p) { value = *p; });
+	tick_until(region, [&] { return void_done && value == 7; });
+}
+
+BOOST_AUTO_TEST_CASE(test_exceptions_are_stored)
+{
+	parallel_region region{"region"};
+	thread::offload_executor executor{single_thread()};
+	executor.add_region(region);
+	bool called = false;
+	executor.offload(region,
+			[]() -> int { throw std::runtime_error{"failed"}; },
+			[&called](int) { called = true; });
+	tick_until(region, [&executor] { return executor.nr_of_waiting_tasks() == 0; });
+	std::exception_ptr error;
+	tick_until(region, [&]
+	{
+		if (!error)
+			error = executor.last_exception();
+		return error != nullptr;
+	});
+	BOOST_CHECK_THROW(std::rethrow_exception(error), std::runtime_error);
+	BOOST_CHECK(!called);
+}
+
+BOOST_AUTO_TEST_CASE(test_bounded_queue)
+{
+	parallel_region region{"region"};
+	BOOST_CHECK_THROW(thread::offload_executor(single_thread(), 0), std::invalid_argument);
+
+	thread::offload_executor executor{single_thread(), 1};
+	executor.add_region(region);
+	std::promise<void> release;
+	auto blocked = release.get_future().share();
+	std::promise<void> started;
+	BOOST_CHECK(executor.offload(region,
+			[blocked, &started] { started.set_value(); blocked.wait(); }, [] {}));
+	started.get_future().wait();
+
+	BOOST_CHECK(executor.offload(region, [] {}, [] {}));
+	BOOST_CHECK(!executor.offload(region, [] {}, [] {}));
+	BOOST_CHECK_EQUAL(executor.nr_of_waiting_tasks(), 1);
+	release.set_value();
+}
+
+BOOST_AUTO_TEST_CASE(test_completion_exceptions_are_stored)
+{
+	parallel_region region{"region"};
+	thread::offload_executor executor{single_thread()};
+	executor.add_region(region);
+	bool called = false;
+	executor.offload(region, [] {}, [] { throw std::runtime_error{"failed"}; });
+	executor.offload(region, [] {}, [&called] { called = true; });
+	// the completion after the throwing one is still delivered.
+	tick_until(region, [&called] { return called; });
+	const auto error = executor.last_exception();
+	BOOST_REQUIRE(error);
+	BOOST_CHECK_THROW(std::rethrow_exception(error), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_region_not_added)
+{
+	parallel_region region{"region"};
+	thread::offload_executor executor{single_thread()};
+	BOOST_CHECK_THROW(executor.offload(region, [] {}, [] {}), std::invalid_argument);
+	BOOST_CHECK_EQUAL(executor.nr_of_waiting_tasks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_region_at_address_of_destroyed_region)
+{
+	thread::offload_executor executor{single_thread()};
+	// both regions are created at the same address.
+	std::aligned_storage_t<sizeof(parallel_region), alignof(parallel_region)> storage;
+	for (auto name : {"first", "second"})
+	{
+		auto region = new (&storage) parallel_region{name};
+		executor.add_region(*region);
+		bool called = false;
+		executor.offload(*region, [] {}, [&called] { called = true; });
+		tick_until(*region, [&called] { return called; });
+		region->~parallel_region();
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,8 +10,11 @@
 #include <boost/test/unit_test.hpp>
 
 #include <functional>
+#include <future>
+#include <system_error>
 
 #include <iostream>
+#include <sched.h>
 
 using namespace fc;
 
@@ -129,5 +132,57 @@ BOOST_AUTO_TEST_CASE(test_main_loop)
 
 }
 
+BOOST_AUTO_TEST_CASE(test_add_tasks)
+{
+	const int nr_of_tasks = 100;
+	std::atomic<int> counter{0};
+	thread::parallel_scheduler scheduler;
+	std::vector<thread::scheduler::task_t> tasks;
+	for (int i = 0; i != nr_of_tasks; ++i)
+		tasks.emplace_back([&counter] { ++counter; });
+	scheduler.add_tasks(tasks);
+
+	while (counter.load() != nr_of_tasks)
+		std::this_thread::yield();
+	BOOST_CHECK_EQUAL(scheduler.nr_of_waiting_tasks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_thread_pool_config)
+{
+	thread::thread_pool_config config;
+	BOOST_CHECK_EQUAL(config.resolved_nr_of_threads(),
+			static_cast<size_t>(thread::parallel_scheduler::num_threads()));
+	config.nr_of_threads = 3;
+	BOOST_CHECK_EQUAL(config.resolved_nr_of_threads(), 3);
+	config.cpu_affinity = {{0}, {0}};
+	BOOST_CHECK_THROW(config.resolved_nr_of_threads(), std::invalid_argument);
+	config.nr_of_threads = 0;
+	BOOST_CHECK_EQUAL(config.resolved_nr_of_threads(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_pinned_workers)
+{
+	thread::thread_pool_config config;
+	config.cpu_affinity = {{0}};
+	thread::parallel_scheduler scheduler{config};
+
+	std::promise<int> cpu;
+	auto result = cpu.get_future();
+	scheduler.add_task([&cpu] { cpu.set_value(sched_getcpu()); });
+	BOOST_CHECK_EQUAL(result.get(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_config_throws)
+{
+	thread::thread_pool_config bad_cpu;
+	bad_cpu.cpu_affinity = {{-1}};
+	BOOST_CHECK_THROW(thread::parallel_scheduler{bad_cpu}, std::invalid_argument);
+
+	thread::thread_pool_config bad_priority;
+	bad_priority.nr_of_threads = 1;
+	bad_priority.fifo_priority = 1000; // out of range for SCHED_FIFO on every platform
+	BOOST_CHECK_THROW(thread::parallel_scheduler{bad_priority}, std::system_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
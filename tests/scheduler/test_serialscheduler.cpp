@@ -25,6 +25,20 @@ BOOST_AUTO_TEST_CASE(test_cant_add_tasks_after_stopped)
 	BOOST_CHECK_THROW(scheduler->add_task([]{}), std::runtime_error);
 }
 
+BOOST_AUTO_TEST_CASE(test_add_tasks_executes_in_order)
+{
+	auto scheduler = make_blocking_scheduler();
+	std::vector<int> order;
+	std::vector<fc::thread::scheduler::task_t> tasks;
+	for (int i = 0; i != 3; ++i)
+		tasks.emplace_back([&order, i] { order.push_back(i); });
+	scheduler->add_tasks(tasks);
+	BOOST_CHECK((order == std::vector<int>{0, 1, 2}));
+
+	scheduler->stop();
+	BOOST_CHECK_THROW(scheduler->add_tasks(tasks), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_nr_of_waiting_tasks)
 {
 	auto scheduler = make_blocking_scheduler();
@@ -0,0 +1,196 @@
+#include <flexcore/scheduler/cyclecontrol.hpp>
+#include <flexcore/scheduler/workstealingscheduler.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace fc;
+
+BOOST_AUTO_TEST_SUITE(test_work_stealing_scheduler)
+
+namespace
+{
+void wait_for(const std::atomic<int>& counter, int expected)
+{
+	while (counter.load() != expected)
+		std::this_thread::yield();
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_executes_all_tasks)
+{
+	const int nr_of_tasks = 1000;
+	std::atomic<int> counter{0};
+	thread::work_stealing_scheduler scheduler;
+	for (int i = 0; i != nr_of_tasks; ++i)
+		scheduler.add_task([&counter] { ++counter; });
+
+	wait_for(counter, nr_of_tasks);
+	BOOST_CHECK_EQUAL(counter.load(), nr_of_tasks);
+	BOOST_CHECK_EQUAL(scheduler.nr_of_waiting_tasks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_tasks_added_by_worker)
+{
+	const int nr_of_children = 100;
+	std::atomic<int> counter{0};
+	thread::work_stealing_scheduler scheduler;
+	scheduler.add_task([&]
+	{
+		for (int i = 0; i != nr_of_children; ++i)
+			scheduler.add_task([&counter] { ++counter; });
+	});
+
+	wait_for(counter, nr_of_children);
+	BOOST_CHECK_EQUAL(counter.load(), nr_of_children);
+}
+
+BOOST_AUTO_TEST_CASE(test_add_tasks)
+{
+	// batches smaller and larger than the number of queues
+	for (int nr_of_tasks : {1, 3, 1000})
+	{
+		std::atomic<int> counter{0};
+		thread::work_stealing_scheduler scheduler;
+		std::vector<thread::scheduler::task_t> tasks;
+		for (int i = 0; i != nr_of_tasks; ++i)
+			tasks.emplace_back([&counter] { ++counter; });
+		scheduler.add_tasks(tasks);
+
+		wait_for(counter, nr_of_tasks);
+		BOOST_CHECK_EQUAL(scheduler.nr_of_waiting_tasks(), 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_add_tasks_from_worker)
+{
+	const int nr_of_children = 100;
+	std::atomic<int> counter{0};
+	thread::work_stealing_scheduler scheduler;
+	scheduler.add_task([&]
+	{
+		std::vector<thread::scheduler::task_t> tasks;
+		for (int i = 0; i != nr_of_children; ++i)
+			tasks.emplace_back([&counter] { ++counter; });
+		scheduler.add_tasks(tasks);
+	});
+
+	wait_for(counter, nr_of_children);
+	BOOST_CHECK_EQUAL(counter.load(), nr_of_children);
+}
+
+BOOST_AUTO_TEST_CASE(test_add_tasks_with_affinity)
+{
+	const int nr_of_tasks = 100;
+	std::atomic<int> counter{0};
+	thread::thread_pool_config config;
+	config.nr_of_threads = 2;
+	thread::work_stealing_scheduler scheduler{config};
+
+	std::vector<thread::scheduler::task_t> tasks;
+	std::vector<thread::scheduler::task_hints> hints(nr_of_tasks);
+	for (int i = 0; i != nr_of_tasks; ++i)
+	{
+		tasks.emplace_back([&counter] { ++counter; });
+		// keys larger than the number of workers wrap around, some tasks have no key.
+		if (i % 3 != 0)
+			hints[i].affinity = i % 5;
+	}
+	scheduler.add_tasks_with_hints(tasks, hints);
+
+	wait_for(counter, nr_of_tasks);
+	BOOST_CHECK_EQUAL(counter.load(), nr_of_tasks);
+	BOOST_CHECK_EQUAL(scheduler.nr_of_waiting_tasks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_affine_tasks_keep_batch_order)
+{
+	// with a single worker nothing is stolen, the owner executes the batch in order.
+	const int nr_of_tasks = 10;
+	std::atomic<int> counter{0};
+	std::vector<int> order;
+	thread::thread_pool_config config;
+	config.nr_of_threads = 1;
+	thread::work_stealing_scheduler scheduler{config};
+
+	std::vector<thread::scheduler::task_t> tasks;
+	std::vector<thread::scheduler::task_hints> hints(nr_of_tasks);
+	for (int i = 0; i != nr_of_tasks; ++i)
+	{
+		tasks.emplace_back([&order, &counter, i] { order.push_back(i); ++counter; });
+		hints[i].affinity = 0;
+	}
+	scheduler.add_tasks_with_hints(tasks, hints);
+
+	wait_for(counter, nr_of_tasks);
+	std::vector<int> expected(nr_of_tasks);
+	std::iota(expected.begin(), expected.end(), 0);
+	BOOST_CHECK(order == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_tasks_keep_batch_order)
+{
+	// same as above for batches without hints.
+	const int nr_of_tasks = 10;
+	std::atomic<int> counter{0};
+	std::vector<int> order;
+	thread::thread_pool_config config;
+	config.nr_of_threads = 1;
+	thread::work_stealing_scheduler scheduler{config};
+
+	std::vector<thread::scheduler::task_t> tasks;
+	for (int i = 0; i != nr_of_tasks; ++i)
+		tasks.emplace_back([&order, &counter, i] { order.push_back(i); ++counter; });
+	scheduler.add_tasks(tasks);
+
+	wait_for(counter, nr_of_tasks);
+	std::vector<int> expected(nr_of_tasks);
+	std::iota(expected.begin(), expected.end(), 0);
+	BOOST_CHECK(order == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_idle_tasks_are_stolen)
+{
+	// one task blocks its worker, all tasks queued behind it need to be stolen.
+	std::atomic<bool> release{false};
+	std::atomic<int> counter{0};
+	thread::work_stealing_scheduler scheduler;
+	const int nr_of_tasks = 100;
+	scheduler.add_task([&]
+	{
+		for (int i = 0; i != nr_of_tasks; ++i)
+			scheduler.add_task([&counter] { ++counter; });
+		while (!release.load())
+			std::this_thread::yield();
+	});
+
+	if (std::thread::hardware_concurrency() > 1)
+	{
+		wait_for(counter, nr_of_tasks);
+		BOOST_CHECK_EQUAL(counter.load(), nr_of_tasks);
+	}
+	release.store(true);
+	wait_for(counter, nr_of_tasks);
+}
+
+BOOST_AUTO_TEST_CASE(test_drop_in_for_cycle_control)
+{
+	const int nr_of_tasks = 20;
+	std::vector<int> values(nr_of_tasks, 0);
+	{
+		thread::cycle_control controller{std::make_unique<thread::work_stealing_scheduler>()};
+		for (auto& value : values)
+			controller.add_task(thread::periodic_task([&value] { value = 1; }),
+			                    thread::cycle_control::fast_tick);
+
+		controller.work();
+		controller.stop();
+	}
+	for (auto value : values)
+		BOOST_CHECK_EQUAL(value, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()